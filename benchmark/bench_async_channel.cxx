@@ -0,0 +1,103 @@
+#include "AsyncChannel.h"
+#include "EventLoop.h"
+#include "LinkedList.h"
+
+#include <benchmark/benchmark.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+using namespace DataStructures;
+
+namespace {
+
+const int items_per_run = 1 << 14;
+
+EventLoop::Task
+produce(AsyncChannel<int>& channel)
+{
+  for (int i = 0; i < items_per_run; ++i)
+    co_await channel.send(i);
+  channel.close();
+}
+
+EventLoop::Task
+consume(AsyncChannel<int>& channel, long& sum)
+{
+  while (std::optional<int> value = co_await channel.receive())
+    sum += *value;
+}
+
+// the stage handoff this replaces: a LinkedList behind a mutex, with
+// condition variables for both back-pressure and wakeups
+class LockedQueue
+{
+private:
+  std::mutex mutex;
+  std::condition_variable not_empty;
+  std::condition_variable not_full;
+  LinkedList<int> items;
+  size_t capacity;
+
+public:
+  explicit LockedQueue(size_t capacity)
+    : capacity(capacity)
+  {}
+
+  void push(int item)
+  {
+    std::unique_lock<std::mutex> lock{ mutex };
+    not_full.wait(lock, [this]() { return items.size() < capacity; });
+    items.push_back(item);
+    not_empty.notify_one();
+  }
+
+  int pop()
+  {
+    std::unique_lock<std::mutex> lock{ mutex };
+    not_empty.wait(lock, [this]() { return !items.empty(); });
+    int item = items.pop_front();
+    not_full.notify_one();
+    return item;
+  }
+};
+
+void
+AsyncChannelHandoff(benchmark::State& state)
+{
+  for (auto _ : state) {
+    EventLoop loop{};
+    AsyncChannel<int> channel{ loop, static_cast<size_t>(state.range(0)) };
+    long sum = 0;
+    loop.spawn(consume(channel, sum));
+    loop.spawn(produce(channel));
+    loop.run();
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * items_per_run);
+}
+
+void
+CondvarHandoff(benchmark::State& state)
+{
+  for (auto _ : state) {
+    LockedQueue queue{ static_cast<size_t>(state.range(0)) };
+    long sum = 0;
+    std::thread consumer{ [&queue, &sum]() {
+      for (int i = 0; i < items_per_run; ++i)
+        sum += queue.pop();
+    } };
+    for (int i = 0; i < items_per_run; ++i)
+      queue.push(i);
+    consumer.join();
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * items_per_run);
+}
+
+} // namespace
+
+BENCHMARK(AsyncChannelHandoff)->Arg(1)->Arg(16)->Arg(256)->UseRealTime();
+BENCHMARK(CondvarHandoff)->Arg(1)->Arg(16)->Arg(256)->UseRealTime();
@@ -0,0 +1,141 @@
+#include "ConcurrentHashMap.h"
+#include "LinkedList.h"
+
+#include <benchmark/benchmark.h>
+
+#include <mutex>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace DataStructures;
+
+namespace {
+
+const int number_of_keys = 1 << 17;
+
+// the structure this replaces: LinkedList buckets behind one mutex
+class LockedLinkedListMap
+{
+private:
+  std::mutex mutex;
+  std::vector<LinkedList<std::pair<int, int>>> buckets;
+
+public:
+  LockedLinkedListMap()
+    : buckets(number_of_keys)
+  {}
+
+  bool find(int key, int& value)
+  {
+    std::lock_guard<std::mutex> lock{ mutex };
+    auto& bucket = buckets[std::hash<int>{}(key) % buckets.size()];
+    for (auto pair : bucket) {
+      if (pair.first == key) {
+        value = pair.second;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // replaces the value of a key already there, like ConcurrentHashMap
+  void insert(int key, int value)
+  {
+    std::lock_guard<std::mutex> lock{ mutex };
+    auto& bucket = buckets[std::hash<int>{}(key) % buckets.size()];
+    size_t index = 0;
+    for (auto pair : bucket) {
+      if (pair.first == key) {
+        bucket.at(index).second = value;
+        return;
+      }
+      index += 1;
+    }
+    bucket.push_back({ key, value });
+  }
+
+  void erase(int key)
+  {
+    std::lock_guard<std::mutex> lock{ mutex };
+    auto& bucket = buckets[std::hash<int>{}(key) % buckets.size()];
+    size_t index = 0;
+    for (auto pair : bucket) {
+      if (pair.first == key) {
+        bucket.erase_at(index);
+        return;
+      }
+      index += 1;
+    }
+  }
+};
+
+// built afresh for each run, so that one run's inserts and erases don't
+// change the map the next one starts from
+template<typename Map>
+Map* shared_map = nullptr;
+
+template<typename Map>
+void
+fill_map(const benchmark::State&)
+{
+  shared_map<Map> = new Map{};
+  for (int key = 0; key < number_of_keys; key += 2)
+    shared_map<Map>->insert(key, key);
+}
+
+template<typename Map>
+void
+drop_map(const benchmark::State&)
+{
+  delete shared_map<Map>;
+  shared_map<Map> = nullptr;
+}
+
+// a mix of operations on random keys, writes_per_16 of every 16 of
+// which are inserts or erases; the low four bits of each draw pick the
+// operation, the next whether a write inserts, and the rest the key
+template<typename Map, int writes_per_16>
+void
+Mix(benchmark::State& state)
+{
+  Map& map = *shared_map<Map>;
+  std::minstd_rand random{ static_cast<unsigned>(state.thread_index()) };
+  int value = 0;
+  for (auto _ : state) {
+    unsigned draw = random();
+    int key = (draw >> 5) % number_of_keys;
+    if ((draw & 15) >= writes_per_16)
+      benchmark::DoNotOptimize(map.find(key, value));
+    else if (draw & 16)
+      map.insert(key, key);
+    else
+      map.erase(key);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+using Concurrent = ConcurrentHashMap<int, int>;
+
+} // namespace
+
+BENCHMARK_TEMPLATE(Mix, LockedLinkedListMap, 1)
+  ->Setup(fill_map<LockedLinkedListMap>)
+  ->Teardown(drop_map<LockedLinkedListMap>)
+  ->ThreadRange(1, 16)
+  ->UseRealTime();
+BENCHMARK_TEMPLATE(Mix, Concurrent, 1)
+  ->Setup(fill_map<Concurrent>)
+  ->Teardown(drop_map<Concurrent>)
+  ->ThreadRange(1, 16)
+  ->UseRealTime();
+BENCHMARK_TEMPLATE(Mix, LockedLinkedListMap, 8)
+  ->Setup(fill_map<LockedLinkedListMap>)
+  ->Teardown(drop_map<LockedLinkedListMap>)
+  ->ThreadRange(1, 16)
+  ->UseRealTime();
+BENCHMARK_TEMPLATE(Mix, Concurrent, 8)
+  ->Setup(fill_map<Concurrent>)
+  ->Teardown(drop_map<Concurrent>)
+  ->ThreadRange(1, 16)
+  ->UseRealTime();
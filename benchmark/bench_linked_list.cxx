@@ -0,0 +1,167 @@
+#include "LinkedList.h"
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <iterator>
+#include <optional>
+#include <vector>
+
+using namespace DataStructures;
+
+namespace {
+
+template<typename ContentHash>
+void
+BM_CompareListsDifferingAtTheEnd(benchmark::State& state)
+{
+  LinkedList<int, ContentHash> a{};
+  LinkedList<int, ContentHash> b{};
+  for (int i = 0; i < state.range(0); ++i) {
+    a.push_back(i);
+    b.push_back(i);
+  }
+  b.pop_back();
+  b.push_back(-1);
+  for (auto _ : state)
+    benchmark::DoNotOptimize(a == b);
+}
+BENCHMARK(BM_CompareListsDifferingAtTheEnd<NoContentHash>)
+  ->Range(1 << 4, 1 << 16);
+BENCHMARK(BM_CompareListsDifferingAtTheEnd<RollingContentHash>)
+  ->Range(1 << 4, 1 << 16);
+
+template<typename ContentHash>
+void
+BM_PushAndPopAtBothEnds(benchmark::State& state)
+{
+  LinkedList<int, ContentHash> list{};
+  for (int i = 0; i < 64; ++i)
+    list.push_back(i);
+  int i = 0;
+  for (auto _ : state) {
+    list.push_back(i++);
+    list.push_front(i++);
+    benchmark::DoNotOptimize(list.pop_front());
+    // pop_back walks the list either way, so it's kept short
+    benchmark::DoNotOptimize(list.pop_back());
+  }
+}
+BENCHMARK(BM_PushAndPopAtBothEnds<NoContentHash>);
+BENCHMARK(BM_PushAndPopAtBothEnds<RollingContentHash>);
+
+const int64_t snapshot_size = 10000000;
+
+// the copy is destroyed outside of the timing, as it would be long
+// after the snapshot was taken
+void
+BM_CopySerially(benchmark::State& state)
+{
+  LinkedList<int> original{};
+  for (int64_t i = 0; i < snapshot_size; ++i)
+    original.push_back(static_cast<int>(i));
+  for (auto _ : state) {
+    std::optional<LinkedList<int>> copy{ original };
+    benchmark::DoNotOptimize(copy->size());
+    state.PauseTiming();
+    copy.reset();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * snapshot_size);
+}
+BENCHMARK(BM_CopySerially)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+void
+BM_CopyInParallel(benchmark::State& state)
+{
+  LinkedList<int> original{};
+  for (int64_t i = 0; i < snapshot_size; ++i)
+    original.push_back(static_cast<int>(i));
+  for (auto _ : state) {
+    std::optional<LinkedList<int>> copy{};
+    copy.emplace(original, static_cast<size_t>(state.range(0)));
+    benchmark::DoNotOptimize(copy->size());
+    state.PauseTiming();
+    copy.reset();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * snapshot_size);
+}
+BENCHMARK(BM_CopyInParallel)
+  ->Unit(benchmark::kMillisecond)
+  ->UseRealTime()
+  ->RangeMultiplier(2)
+  ->Range(1, 8);
+
+void
+BM_BuildFromRangeInParallel(benchmark::State& state)
+{
+  std::vector<int> source(snapshot_size);
+  for (int64_t i = 0; i < snapshot_size; ++i)
+    source[i] = static_cast<int>(i);
+  for (auto _ : state) {
+    std::optional<LinkedList<int>> built{};
+    built.emplace(
+      source.begin(), source.end(), static_cast<size_t>(state.range(0)));
+    benchmark::DoNotOptimize(built->size());
+    state.PauseTiming();
+    built.reset();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * snapshot_size);
+}
+BENCHMARK(BM_BuildFromRangeInParallel)
+  ->Unit(benchmark::kMillisecond)
+  ->UseRealTime()
+  ->RangeMultiplier(2)
+  ->Range(1, 8);
+
+// a producer fills the queue with a batch, which the consumer then takes
+// out into a buffer of its own; only the consumer is timed
+template<typename Consume>
+void
+consume_batches(benchmark::State& state, Consume consume)
+{
+  LinkedList<int> queue{};
+  std::vector<int> consumed(state.range(0));
+  for (auto _ : state) {
+    for (int64_t i = 0; i < state.range(0); ++i)
+      queue.push_back(static_cast<int>(i));
+    auto start = std::chrono::steady_clock::now();
+    consume(queue, consumed);
+    auto stop = std::chrono::steady_clock::now();
+    benchmark::DoNotOptimize(consumed.data());
+    state.SetIterationTime(std::chrono::duration<double>(stop - start).count());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void
+BM_ConsumeWithPopFront(benchmark::State& state)
+{
+  consume_batches(
+    state, [](LinkedList<int>& queue, std::vector<int>& consumed) {
+      size_t taken = 0;
+      while (!queue.empty())
+        consumed[taken++] = queue.pop_front();
+    });
+}
+BENCHMARK(BM_ConsumeWithPopFront)
+  ->RangeMultiplier(8)
+  ->Range(16, 64 << 10)
+  ->UseManualTime();
+
+void
+BM_ConsumeWithDrain(benchmark::State& state)
+{
+  consume_batches(
+    state, [](LinkedList<int>& queue, std::vector<int>& consumed) {
+      queue.drain(consumed.begin());
+    });
+}
+BENCHMARK(BM_ConsumeWithDrain)
+  ->RangeMultiplier(8)
+  ->Range(16, 64 << 10)
+  ->UseManualTime();
+
+} // namespace
@@ -0,0 +1,63 @@
+#include "LinkedList.h"
+#include "NodeReclamation.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+using namespace DataStructures;
+
+namespace {
+
+// the time the calling thread spends in clear(), reported as counters
+// since the mean hides the tail that matters here
+template<typename List>
+void
+clear_latency(benchmark::State& state)
+{
+  std::vector<double> latencies{};
+  for (auto _ : state) {
+    state.PauseTiming();
+    List list{};
+    for (int64_t i = 0; i < state.range(0); ++i)
+      list.push_back(static_cast<int>(i));
+    state.ResumeTiming();
+
+    auto start = std::chrono::steady_clock::now();
+    list.clear();
+    auto stop = std::chrono::steady_clock::now();
+    latencies.push_back(
+      std::chrono::duration<double, std::micro>(stop - start).count());
+
+    // the reclaimer mustn't fall behind across iterations, or the
+    // limit would start handing the work back
+    state.PauseTiming();
+    BackgroundReclamation::flush();
+    state.ResumeTiming();
+  }
+  std::sort(latencies.begin(), latencies.end());
+  state.counters["p50_us"] = latencies[latencies.size() / 2];
+  state.counters["p99_us"] = latencies[latencies.size() * 99 / 100];
+  state.counters["max_us"] = latencies.back();
+}
+
+void
+BM_LinkedListClear(benchmark::State& state)
+{
+  clear_latency<LinkedList<int>>(state);
+}
+BENCHMARK(BM_LinkedListClear)->Arg(1000)->Arg(100000)->Arg(1000000);
+
+void
+BM_LinkedListClearInBackground(benchmark::State& state)
+{
+  clear_latency<LinkedList<int, NoContentHash, BackgroundReclamation>>(state);
+}
+BENCHMARK(BM_LinkedListClearInBackground)
+  ->Arg(1000)
+  ->Arg(100000)
+  ->Arg(1000000);
+
+} // namespace
@@ -0,0 +1,114 @@
+#include "PairingHeap.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace DataStructures;
+
+namespace {
+
+struct Edge
+{
+  int to;
+  uint64_t weight;
+};
+
+using Graph = std::vector<std::vector<Edge>>;
+using Entry = std::pair<uint64_t, int>;
+
+const uint64_t unreached = std::numeric_limits<uint64_t>::max();
+
+Graph
+random_graph(int vertices, int edges_per_vertex)
+{
+  std::mt19937 random{ 7 };
+  std::uniform_int_distribution<int> vertex{ 0, vertices - 1 };
+  std::uniform_int_distribution<uint64_t> weight{ 1, 1000 };
+  Graph graph(vertices);
+  for (int from = 0; from < vertices; ++from)
+    for (int i = 0; i < edges_per_vertex; ++i)
+      graph[from].push_back(Edge{ vertex(random), weight(random) });
+  return graph;
+}
+
+std::vector<uint64_t>
+dijkstra_with_decrease_key(const Graph& graph)
+{
+  std::vector<uint64_t> distance(graph.size(), unreached);
+  std::vector<PairingHeap<Entry>::handle> handles(graph.size());
+  std::vector<bool> queued(graph.size(), false);
+  PairingHeap<Entry> frontier{};
+  distance[0] = 0;
+  handles[0] = frontier.push({ 0, 0 });
+  queued[0] = true;
+  while (!frontier.empty()) {
+    int from = frontier.pop().second;
+    queued[from] = false;
+    for (const Edge& edge : graph[from]) {
+      uint64_t through = distance[from] + edge.weight;
+      if (through >= distance[edge.to])
+        continue;
+      bool was_reached = distance[edge.to] != unreached;
+      distance[edge.to] = through;
+      if (was_reached && queued[edge.to]) {
+        frontier.decrease_key(handles[edge.to], { through, edge.to });
+      } else {
+        handles[edge.to] = frontier.push({ through, edge.to });
+        queued[edge.to] = true;
+      }
+    }
+  }
+  return distance;
+}
+
+std::vector<uint64_t>
+dijkstra_with_lazy_deletion(const Graph& graph)
+{
+  std::vector<uint64_t> distance(graph.size(), unreached);
+  std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>>
+    frontier{};
+  distance[0] = 0;
+  frontier.push({ 0, 0 });
+  while (!frontier.empty()) {
+    Entry entry = frontier.top();
+    frontier.pop();
+    if (entry.first != distance[entry.second])
+      continue;
+    for (const Edge& edge : graph[entry.second]) {
+      uint64_t through = entry.first + edge.weight;
+      if (through >= distance[edge.to])
+        continue;
+      distance[edge.to] = through;
+      frontier.push({ through, edge.to });
+    }
+  }
+  return distance;
+}
+
+void
+DijkstraPairingHeap(benchmark::State& state)
+{
+  Graph graph = random_graph(state.range(0), 8);
+  for (auto _ : state)
+    benchmark::DoNotOptimize(dijkstra_with_decrease_key(graph));
+}
+
+void
+DijkstraStdPriorityQueue(benchmark::State& state)
+{
+  Graph graph = random_graph(state.range(0), 8);
+  for (auto _ : state)
+    benchmark::DoNotOptimize(dijkstra_with_lazy_deletion(graph));
+}
+
+} // namespace
+
+BENCHMARK(DijkstraPairingHeap)->Range(1 << 10, 1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK(DijkstraStdPriorityQueue)->Range(1 << 10, 1 << 20)->Unit(benchmark::kMillisecond);
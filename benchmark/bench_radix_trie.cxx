@@ -0,0 +1,138 @@
+#include "LinkedList.h"
+#include "RadixTrie.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace DataStructures;
+
+namespace {
+
+const size_t number_of_hosts = 1000000;
+
+// hostnames in a few thousand domains, which share long prefixes much
+// as real ones sharing a suffix would once reversed
+std::vector<std::string>
+hostnames()
+{
+  std::mt19937_64 random{ 3 };
+  std::vector<std::string> hosts(number_of_hosts);
+  for (size_t i = 0; i < hosts.size(); ++i)
+    hosts[i] = "com.example" + std::to_string(random() % 4096) + ".host" +
+               std::to_string(i);
+  return hosts;
+}
+
+const std::vector<std::string>&
+shared_hostnames()
+{
+  static const std::vector<std::string> hosts = hostnames();
+  return hosts;
+}
+
+const RadixTrie&
+shared_trie()
+{
+  static const RadixTrie trie = []() {
+    RadixTrie hosts{};
+    for (const std::string& host : shared_hostnames())
+      hosts.insert(host);
+    return hosts;
+  }();
+  return trie;
+}
+
+const LinkedList<std::string>&
+shared_list()
+{
+  static const LinkedList<std::string> list = []() {
+    LinkedList<std::string> hosts{};
+    for (const std::string& host : shared_hostnames())
+      hosts.push_back(host);
+    return hosts;
+  }();
+  return list;
+}
+
+void
+BM_RadixTrieInsert(benchmark::State& state)
+{
+  const std::vector<std::string>& hosts = shared_hostnames();
+  for (auto _ : state) {
+    RadixTrie trie{};
+    for (const std::string& host : hosts)
+      trie.insert(host);
+    benchmark::DoNotOptimize(trie.size());
+  }
+  state.SetItemsProcessed(state.iterations() * hosts.size());
+}
+BENCHMARK(BM_RadixTrieInsert)->Unit(benchmark::kMillisecond);
+
+void
+BM_RadixTrieContains(benchmark::State& state)
+{
+  const std::vector<std::string>& hosts = shared_hostnames();
+  const RadixTrie& trie = shared_trie();
+  std::mt19937_64 random{ 7 };
+  for (auto _ : state)
+    benchmark::DoNotOptimize(trie.contains(hosts[random() % hosts.size()]));
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RadixTrieContains);
+
+void
+BM_LinkedListScanContains(benchmark::State& state)
+{
+  const std::vector<std::string>& hosts = shared_hostnames();
+  const LinkedList<std::string>& list = shared_list();
+  std::mt19937_64 random{ 7 };
+  for (auto _ : state) {
+    const std::string& wanted = hosts[random() % hosts.size()];
+    bool found = false;
+    for (auto it = list.begin(); it != list.end() && !found; ++it)
+      found = *it == wanted;
+    benchmark::DoNotOptimize(found);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LinkedListScanContains)->Unit(benchmark::kMillisecond);
+
+void
+BM_RadixTriePrefixQuery(benchmark::State& state)
+{
+  // every host in one domain, about 250 of them
+  const RadixTrie& trie = shared_trie();
+  std::mt19937_64 random{ 7 };
+  for (auto _ : state) {
+    std::string prefix =
+      "com.example" + std::to_string(random() % 4096) + ".";
+    size_t matches = 0;
+    trie.for_each_with_prefix(prefix,
+                              [&matches](const std::string&) { ++matches; });
+    benchmark::DoNotOptimize(matches);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RadixTriePrefixQuery);
+
+void
+BM_LinkedListScanPrefixQuery(benchmark::State& state)
+{
+  const LinkedList<std::string>& list = shared_list();
+  std::mt19937_64 random{ 7 };
+  for (auto _ : state) {
+    std::string prefix =
+      "com.example" + std::to_string(random() % 4096) + ".";
+    size_t matches = 0;
+    for (const std::string& host : list)
+      matches += host.compare(0, prefix.size(), prefix) == 0;
+    benchmark::DoNotOptimize(matches);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LinkedListScanPrefixQuery)->Unit(benchmark::kMillisecond);
+
+} // namespace
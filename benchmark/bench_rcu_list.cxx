@@ -0,0 +1,82 @@
+#include "LinkedList.h"
+#include "RcuList.h"
+
+#include <benchmark/benchmark.h>
+
+#include <shared_mutex>
+
+using namespace DataStructures;
+
+namespace {
+
+// a routing table of this many entries, looked up by every reader
+const int table_size = 64;
+
+struct Route
+{
+  int prefix;
+  int next_hop;
+
+  bool operator==(const Route& other) const
+  {
+    return prefix == other.prefix && next_hop == other.next_hop;
+  }
+  bool operator!=(const Route& other) const { return !operator==(other); }
+};
+
+template<typename List>
+List&
+filled_table()
+{
+  // filled on first use, which every thread waits for
+  static List table{};
+  static bool filled = [](List& routes) {
+    for (int i = 0; i < table_size; ++i)
+      routes.push_back(Route{ i, i * 7 });
+    return true;
+  }(table);
+  benchmark::DoNotOptimize(filled);
+  return table;
+}
+
+std::shared_mutex locked_table_mutex{};
+
+void
+BM_RcuListLookup(benchmark::State& state)
+{
+  RcuList<Route>& table = filled_table<RcuList<Route>>();
+  int prefix = state.thread_index();
+  for (auto _ : state) {
+    Route found{};
+    table.find(
+      [prefix](const Route& route) { return route.prefix == prefix; }, found);
+    benchmark::DoNotOptimize(found);
+    prefix = (prefix + 1) % table_size;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RcuListLookup)->ThreadRange(1, 32)->UseRealTime();
+
+void
+BM_SharedMutexLinkedListLookup(benchmark::State& state)
+{
+  LinkedList<Route>& table = filled_table<LinkedList<Route>>();
+  int prefix = state.thread_index();
+  for (auto _ : state) {
+    Route found{};
+    {
+      std::shared_lock<std::shared_mutex> lock{ locked_table_mutex };
+      for (auto it = table.begin(); it != table.end(); ++it)
+        if ((*it).prefix == prefix) {
+          found = *it;
+          break;
+        }
+    }
+    benchmark::DoNotOptimize(found);
+    prefix = (prefix + 1) % table_size;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SharedMutexLinkedListLookup)->ThreadRange(1, 32)->UseRealTime();
+
+} // namespace
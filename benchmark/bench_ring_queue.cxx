@@ -0,0 +1,69 @@
+#include "LinkedList.h"
+#include "RingQueue.h"
+#include "SpscRingQueue.h"
+
+#include <benchmark/benchmark.h>
+
+#include <thread>
+
+using namespace DataStructures;
+
+namespace {
+
+// a steady state queue of the given depth, as in a metrics pipeline that
+// keeps up with its producers
+void
+LinkedListFifo(benchmark::State& state)
+{
+  LinkedList<long> queue{};
+  for (long i = 0; i < state.range(0); ++i)
+    queue.push_back(i);
+  long sample = 0;
+  for (auto _ : state) {
+    queue.push_back(sample++);
+    benchmark::DoNotOptimize(queue.pop_front());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void
+RingQueueFifo(benchmark::State& state)
+{
+  RingQueue<long> queue(state.range(0) + 1);
+  for (long i = 0; i < state.range(0); ++i)
+    queue.push_back(i);
+  long sample = 0;
+  for (auto _ : state) {
+    queue.push_back(sample++);
+    benchmark::DoNotOptimize(queue.pop_front());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void
+SpscRingQueueAcrossThreads(benchmark::State& state)
+{
+  SpscRingQueue<long> queue(state.range(0));
+  for (auto _ : state) {
+    const long number_of_samples = 1 << 16;
+    std::thread consumer{ [&queue]() {
+      long popped;
+      for (long received = 0; received < number_of_samples;)
+        if (queue.try_pop_front(popped))
+          received += 1;
+        else
+          std::this_thread::yield();
+    } };
+    for (long i = 0; i < number_of_samples; ++i)
+      while (!queue.push_back(i))
+        std::this_thread::yield();
+    consumer.join();
+  }
+  state.SetItemsProcessed(state.iterations() * (1 << 16));
+}
+
+} // namespace
+
+BENCHMARK(LinkedListFifo)->Arg(16)->Arg(1024);
+BENCHMARK(RingQueueFifo)->Arg(16)->Arg(1024);
+BENCHMARK(SpscRingQueueAcrossThreads)->Arg(1024)->UseRealTime();
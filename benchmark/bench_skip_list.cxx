@@ -0,0 +1,95 @@
+#include "LinkedList.h"
+#include "SkipList.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <vector>
+
+using namespace DataStructures;
+
+namespace {
+
+// the keys are the even numbers below 2n, looked up in a shuffled order
+// so that neither cache nor branch predictor learns the pattern
+std::vector<int>
+shuffled_keys(int n)
+{
+  std::vector<int> keys(n);
+  for (int i = 0; i < n; ++i)
+    keys[i] = 2 * i;
+  std::shuffle(keys.begin(), keys.end(), std::mt19937{ 42 });
+  return keys;
+}
+
+void
+LinkedListLinearSearch(benchmark::State& state)
+{
+  const int n = state.range(0);
+  LinkedList<int> list{};
+  for (int i = 0; i < n; ++i)
+    list.push_back(2 * i);
+  std::vector<int> keys = shuffled_keys(n);
+  size_t next_key = 0;
+  for (auto _ : state) {
+    int key = keys[next_key++ % keys.size()];
+    auto it = list.begin();
+    while (it != list.end() && *it < key)
+      ++it;
+    benchmark::DoNotOptimize(it);
+  }
+}
+
+void
+SkipListFind(benchmark::State& state)
+{
+  const int n = state.range(0);
+  SkipList<int> list{};
+  std::vector<int> keys = shuffled_keys(n);
+  for (int key : keys)
+    list.insert(key);
+  size_t next_key = 0;
+  for (auto _ : state) {
+    auto it = list.find(keys[next_key++ % keys.size()]);
+    benchmark::DoNotOptimize(it);
+  }
+}
+
+void
+ConcurrentSkipListFind(benchmark::State& state)
+{
+  const int n = state.range(0);
+  SkipList<int, std::less<int>, true> list{};
+  std::vector<int> keys = shuffled_keys(n);
+  for (int key : keys)
+    list.insert(key);
+  size_t next_key = 0;
+  for (auto _ : state) {
+    auto it = list.find(keys[next_key++ % keys.size()]);
+    benchmark::DoNotOptimize(it);
+  }
+}
+
+void
+StdSetFind(benchmark::State& state)
+{
+  const int n = state.range(0);
+  std::set<int> set{};
+  std::vector<int> keys = shuffled_keys(n);
+  for (int key : keys)
+    set.insert(key);
+  size_t next_key = 0;
+  for (auto _ : state) {
+    auto it = set.find(keys[next_key++ % keys.size()]);
+    benchmark::DoNotOptimize(it);
+  }
+}
+
+} // namespace
+
+BENCHMARK(LinkedListLinearSearch)->RangeMultiplier(10)->Range(1000, 10000000);
+BENCHMARK(SkipListFind)->RangeMultiplier(10)->Range(1000, 10000000);
+BENCHMARK(ConcurrentSkipListFind)->RangeMultiplier(10)->Range(1000, 10000000);
+BENCHMARK(StdSetFind)->RangeMultiplier(10)->Range(1000, 10000000);
@@ -0,0 +1,103 @@
+#include "LinkedList.h"
+#include "TimingWheel.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace DataStructures;
+
+namespace {
+
+// timeouts of up to a minute, counted in milliseconds
+const uint64_t longest_timeout = 60000;
+
+std::vector<uint64_t>
+random_timeouts(int64_t count)
+{
+  std::mt19937_64 random{ 11 };
+  std::vector<uint64_t> timeouts(count);
+  for (uint64_t& timeout : timeouts)
+    timeout = 1 + random() % longest_timeout;
+  return timeouts;
+}
+
+void
+BM_TimingWheelSchedule(benchmark::State& state)
+{
+  std::vector<uint64_t> timeouts = random_timeouts(state.range(0));
+  for (auto _ : state) {
+    TimingWheel<int> wheel{};
+    for (uint64_t timeout : timeouts)
+      wheel.schedule(timeout, 0);
+    benchmark::DoNotOptimize(wheel.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TimingWheelSchedule)->Arg(100000)->Arg(1000000);
+
+void
+BM_TimingWheelScheduleThenCancel(benchmark::State& state)
+{
+  std::vector<uint64_t> timeouts = random_timeouts(state.range(0));
+  std::vector<TimingWheel<int>::handle> handles(timeouts.size());
+  for (auto _ : state) {
+    TimingWheel<int> wheel{};
+    for (size_t i = 0; i < timeouts.size(); ++i)
+      handles[i] = wheel.schedule(timeouts[i], 0);
+    for (TimingWheel<int>::handle timer : handles)
+      wheel.cancel(timer);
+    benchmark::DoNotOptimize(wheel.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TimingWheelScheduleThenCancel)->Arg(100000)->Arg(1000000);
+
+void
+BM_TimingWheelExpire(benchmark::State& state)
+{
+  // a simulated clock ticking a millisecond at a time until every timer
+  // has gone off
+  std::vector<uint64_t> timeouts = random_timeouts(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    TimingWheel<int> wheel{};
+    for (uint64_t timeout : timeouts)
+      wheel.schedule(timeout, 0);
+    state.ResumeTiming();
+    size_t expired = 0;
+    for (uint64_t now = 1; now <= longest_timeout; ++now)
+      expired += wheel.advance(now).size();
+    benchmark::DoNotOptimize(expired);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TimingWheelExpire)->Arg(100000)->Arg(1000000);
+
+void
+BM_SortedLinkedListSchedule(benchmark::State& state)
+{
+  // the approach the wheel replaces: scan for the place to insert
+  std::vector<uint64_t> timeouts = random_timeouts(state.range(0));
+  for (auto _ : state) {
+    LinkedList<uint64_t> deadlines{};
+    for (uint64_t timeout : timeouts) {
+      if (deadlines.empty() || timeout <= deadlines.cfront()) {
+        deadlines.push_front(timeout);
+        continue;
+      }
+      auto before = deadlines.begin();
+      auto after = before;
+      for (++after; after != deadlines.end() && *after < timeout; ++after)
+        before = after;
+      deadlines.insert_after(before, timeout);
+    }
+    benchmark::DoNotOptimize(deadlines.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SortedLinkedListSchedule)->Arg(1000)->Arg(10000);
+
+} // namespace
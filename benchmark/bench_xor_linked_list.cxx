@@ -0,0 +1,75 @@
+#include "LinkedList.h"
+#include "XorLinkedList.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <list>
+
+using namespace DataStructures;
+
+namespace {
+
+template<typename List>
+List
+filled(int64_t length)
+{
+  List list{};
+  for (int64_t i = 0; i < length; ++i)
+    list.push_back(static_cast<int>(i));
+  return list;
+}
+
+template<typename List>
+void
+BM_WalkForward(benchmark::State& state)
+{
+  List list = filled<List>(state.range(0));
+  for (auto _ : state) {
+    int64_t sum = 0;
+    for (auto it = list.begin(); it != list.end(); ++it)
+      sum += *it;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_WalkForward<LinkedList<int>>)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_WalkForward<XorLinkedList<int>>)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_WalkForward<std::list<int>>)->Range(1 << 10, 1 << 20);
+
+template<typename List>
+void
+BM_WalkBackward(benchmark::State& state)
+{
+  List list = filled<List>(state.range(0));
+  for (auto _ : state) {
+    int64_t sum = 0;
+    for (auto it = list.rbegin(); it != list.rend(); ++it)
+      sum += *it;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_WalkBackward<XorLinkedList<int>>)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_WalkBackward<std::list<int>>)->Range(1 << 10, 1 << 20);
+
+template<typename List>
+void
+BM_PushBackThenPopBack(benchmark::State& state)
+{
+  List list = filled<List>(state.range(0));
+  int i = 0;
+  for (auto _ : state) {
+    list.push_back(i++);
+    if constexpr (std::is_same_v<List, std::list<int>>)
+      list.pop_back();
+    else
+      benchmark::DoNotOptimize(list.pop_back());
+  }
+}
+// the singly linked list walks to the end on every pop_back
+BENCHMARK(BM_PushBackThenPopBack<LinkedList<int>>)->Range(1 << 4, 1 << 12);
+BENCHMARK(BM_PushBackThenPopBack<XorLinkedList<int>>)->Range(1 << 4, 1 << 12);
+BENCHMARK(BM_PushBackThenPopBack<std::list<int>>)->Range(1 << 4, 1 << 12);
+
+} // namespace
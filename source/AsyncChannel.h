@@ -0,0 +1,137 @@
+#ifndef __DATA_STRUCTURES_ASYNC_CHANNEL
+#define __DATA_STRUCTURES_ASYNC_CHANNEL
+
+#include "EventLoop.h"
+#include "LinkedList.h"
+
+#include <cassert>
+#include <coroutine>
+#include <cstddef>
+#include <optional>
+
+namespace DataStructures {
+
+/**
+  A bounded first-in first-out queue that coroutines on one `EventLoop`
+  pass values through.
+
+  `co_await channel.send(value)` suspends the sender while the channel
+  is full, and `co_await channel.receive()` suspends the receiver while
+  it is empty, so a fast producer is held back to the pace of its
+  consumers.  Suspended coroutines wait in order on intrusive lists
+  threaded through their own frames, and are resumed through the loop
+  rather than inline.
+
+  A coroutine must not be destroyed while it is suspended on a channel
+  that will be used again.
+*/
+template<typename T>
+class AsyncChannel
+{
+public:
+  /**
+    The awaitable returned by `send`, which resumes with false if the
+    channel was closed before the value could be sent.
+  */
+  class SendAwaiter
+  {
+  private:
+    AsyncChannel& channel;
+    T value;
+    std::coroutine_handle<> coroutine;
+    SendAwaiter* next;
+    bool sent;
+    friend class AsyncChannel;
+
+  public:
+    SendAwaiter(AsyncChannel& channel, const T& value);
+    bool await_ready();
+    void await_suspend(std::coroutine_handle<> coroutine);
+    bool await_resume() const;
+  };
+
+  /**
+    The awaitable returned by `receive`, which resumes with nothing once
+    the channel is closed and drained.
+  */
+  class ReceiveAwaiter
+  {
+  private:
+    AsyncChannel& channel;
+    std::optional<T> value;
+    std::coroutine_handle<> coroutine;
+    ReceiveAwaiter* next;
+    friend class AsyncChannel;
+
+  public:
+    explicit ReceiveAwaiter(AsyncChannel& channel);
+    bool await_ready();
+    void await_suspend(std::coroutine_handle<> coroutine);
+    std::optional<T> await_resume();
+  };
+
+private:
+  EventLoop& loop;
+  LinkedList<T> buffer;
+  size_t capacity;
+  bool is_closed;
+
+  SendAwaiter* first_sender;
+  SendAwaiter* last_sender;
+  ReceiveAwaiter* first_receiver;
+  ReceiveAwaiter* last_receiver;
+
+public:
+  /**
+    Construct an empty, open channel.
+
+    @param  loop      The loop the channel's coroutines run on
+    @param  capacity  How many values may be buffered before senders
+                      wait; with 0 each sender waits for a receiver
+  */
+  AsyncChannel(EventLoop& loop, size_t capacity);
+
+  AsyncChannel(const AsyncChannel& other) = delete;
+  AsyncChannel& operator=(const AsyncChannel& other) = delete;
+
+  /**
+    The number of values buffered in the channel.
+  */
+  size_t size() const;
+
+  /**
+    Check if the channel has been closed.
+  */
+  bool closed() const;
+
+  /**
+    Send a value, waiting for room if the channel is full.
+
+    @param  value   The datum to send
+  */
+  SendAwaiter send(const T& value);
+
+  /**
+    Receive the oldest value, waiting for one if the channel is empty.
+  */
+  ReceiveAwaiter receive();
+
+  /**
+    Stop accepting values.  Waiting senders resume with false, and
+    receivers get nothing once the buffered values run out.
+  */
+  void close();
+
+private:
+  /**
+    Take the value of the longest waiting sender, if there is one, and
+    schedule it to carry on.
+  */
+  std::optional<T> take_from_sender();
+};
+
+#include "AsyncChannel.inl"
+
+} // namespace DataStructures
+
+#endif
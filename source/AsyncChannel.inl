@@ -0,0 +1,171 @@
+// inlined in AsyncChannel.h
+
+template<typename T>
+DataStructures::AsyncChannel<T>::SendAwaiter::SendAwaiter(
+  AsyncChannel& channel,
+  const T& value)
+  : channel(channel)
+  , value(value)
+  , next(nullptr)
+  , sent(false)
+{}
+
+template<typename T>
+bool
+DataStructures::AsyncChannel<T>::SendAwaiter::await_ready()
+{
+  if (channel.is_closed)
+    return true;
+
+  // a waiting receiver means the buffer is empty, so the value can go
+  // straight to it
+  ReceiveAwaiter* receiver = channel.first_receiver;
+  if (receiver != nullptr) {
+    channel.first_receiver = receiver->next;
+    if (channel.first_receiver == nullptr)
+      channel.last_receiver = nullptr;
+    receiver->value = value;
+    channel.loop.schedule(receiver->coroutine);
+    sent = true;
+    return true;
+  }
+
+  if (channel.buffer.size() < channel.capacity) {
+    channel.buffer.push_back(value);
+    sent = true;
+    return true;
+  }
+  return false;
+}
+
+template<typename T>
+void
+DataStructures::AsyncChannel<T>::SendAwaiter::await_suspend(
+  std::coroutine_handle<> coroutine)
+{
+  this->coroutine = coroutine;
+  if (channel.last_sender != nullptr)
+    channel.last_sender->next = this;
+  else
+    channel.first_sender = this;
+  channel.last_sender = this;
+}
+
+template<typename T>
+bool
+DataStructures::AsyncChannel<T>::SendAwaiter::await_resume() const
+{
+  return sent;
+}
+
+template<typename T>
+DataStructures::AsyncChannel<T>::ReceiveAwaiter::ReceiveAwaiter(
+  AsyncChannel& channel)
+  : channel(channel)
+  , next(nullptr)
+{}
+
+template<typename T>
+bool
+DataStructures::AsyncChannel<T>::ReceiveAwaiter::await_ready()
+{
+  if (!channel.buffer.empty()) {
+    value = channel.buffer.pop_front();
+    // that made room for the longest waiting sender
+    std::optional<T> sent = channel.take_from_sender();
+    if (sent)
+      channel.buffer.push_back(*sent);
+    return true;
+  }
+  value = channel.take_from_sender();
+  return value.has_value() || channel.is_closed;
+}
+
+template<typename T>
+void
+DataStructures::AsyncChannel<T>::ReceiveAwaiter::await_suspend(
+  std::coroutine_handle<> coroutine)
+{
+  this->coroutine = coroutine;
+  if (channel.last_receiver != nullptr)
+    channel.last_receiver->next = this;
+  else
+    channel.first_receiver = this;
+  channel.last_receiver = this;
+}
+
+template<typename T>
+std::optional<T>
+DataStructures::AsyncChannel<T>::ReceiveAwaiter::await_resume()
+{
+  return std::move(value);
+}
+
+template<typename T>
+DataStructures::AsyncChannel<T>::AsyncChannel(EventLoop& loop,
+                                              size_t capacity)
+  : loop(loop)
+  , capacity(capacity)
+  , is_closed(false)
+  , first_sender(nullptr)
+  , last_sender(nullptr)
+  , first_receiver(nullptr)
+  , last_receiver(nullptr)
+{}
+
+template<typename T>
+size_t
+DataStructures::AsyncChannel<T>::size() const
+{
+  return buffer.size();
+}
+
+template<typename T>
+bool
+DataStructures::AsyncChannel<T>::closed() const
+{
+  return is_closed;
+}
+
+template<typename T>
+typename AsyncChannel<T>::SendAwaiter
+DataStructures::AsyncChannel<T>::send(const T& value)
+{
+  return SendAwaiter{ *this, value };
+}
+
+template<typename T>
+typename AsyncChannel<T>::ReceiveAwaiter
+DataStructures::AsyncChannel<T>::receive()
+{
+  return ReceiveAwaiter{ *this };
+}
+
+template<typename T>
+void
+DataStructures::AsyncChannel<T>::close()
+{
+  is_closed = true;
+  for (; first_sender != nullptr; first_sender = first_sender->next)
+    loop.schedule(first_sender->coroutine);
+  last_sender = nullptr;
+  // receivers only wait on an empty buffer, so they get nothing
+  for (; first_receiver != nullptr; first_receiver = first_receiver->next)
+    loop.schedule(first_receiver->coroutine);
+  last_receiver = nullptr;
+}
+
+template<typename T>
+std::optional<T>
+DataStructures::AsyncChannel<T>::take_from_sender()
+{
+  SendAwaiter* sender = first_sender;
+  if (sender == nullptr)
+    return std::nullopt;
+  first_sender = sender->next;
+  if (first_sender == nullptr)
+    last_sender = nullptr;
+  sender->sent = true;
+  loop.schedule(sender->coroutine);
+  return std::move(sender->value);
+}
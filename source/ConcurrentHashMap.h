@@ -0,0 +1,208 @@
+#ifndef __DATA_STRUCTURES_CONCURRENT_HASH_MAP
+#define __DATA_STRUCTURES_CONCURRENT_HASH_MAP
+
+#include "EpochReclamation.h"
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+
+namespace DataStructures {
+
+/**
+  A hash map that many threads may read and write at once.
+
+  Buckets are singly linked chains.  Writers lock one of a fixed number
+  of stripes, each covering every bucket whose index is congruent modulo
+  the stripe count, so writers to different stripes never wait for each
+  other.  Readers take no lock at all: chained elements are never
+  changed once linked, only replaced, and replaced or erased elements
+  are freed through `EpochReclamation` once no reader can be looking.
+
+  When the map gets too full it doubles its bucket count, but instead of
+  moving every element at once each later write moves a bucket or two,
+  so no single call pays for the whole resize.
+*/
+template<typename K,
+         typename V,
+         typename Hash = std::hash<K>,
+         typename KeyEqual = std::equal_to<K>>
+class ConcurrentHashMap
+{
+public:
+  /**
+    The number of locks writers are spread across.
+  */
+  static constexpr size_t stripe_count = 64;
+
+private:
+  struct Element
+  {
+    const K key;
+    const V value;
+    const size_t hash;
+    std::atomic<Element*> next;
+  };
+
+  struct Table
+  {
+    size_t mask;
+    std::atomic<Element*>* buckets;
+    // the table this one's buckets are moved to on resize, set before
+    // the first is moved, so that a reader finding a bucket moved out
+    // from under it can follow
+    Table* successor;
+  };
+
+  /**
+    The tables in use, which only change together.  While a resize is
+    under way previous is the smaller table, whose buckets are swapped
+    for a marker as they are moved to current.
+  */
+  struct State
+  {
+    Table* current;
+    Table* previous;
+    std::atomic<size_t> next_to_move;
+    std::atomic<size_t> moved;
+  };
+
+  // padded rather than aligned, as the map itself may be allocated with
+  // plain `new`, so that neighbouring stripes rarely share a cache line
+  struct Stripe
+  {
+    std::mutex mutex;
+    char padding[64 - sizeof(std::mutex) % 64];
+  };
+
+  std::atomic<State*> state;
+  std::atomic<size_t> number_of_elements;
+  mutable Stripe stripes[stripe_count];
+  std::mutex resize_mutex;
+  Hash hasher;
+  KeyEqual key_equal;
+
+public:
+  /**
+    Construct an empty map.
+
+    @param  bucket_count  The number of buckets to start with, rounded up
+                          to a power of two no less than stripe_count
+  */
+  explicit ConcurrentHashMap(size_t bucket_count = stripe_count);
+
+  ConcurrentHashMap(const ConcurrentHashMap& other) = delete;
+  ConcurrentHashMap& operator=(const ConcurrentHashMap& other) = delete;
+
+  /**
+    Destroy the map.  No other thread may be using it.
+  */
+  ~ConcurrentHashMap();
+
+  /**
+    The number of elements in the map.
+  */
+  size_t size() const;
+
+  /**
+    Check if there are exactly 0 elements in the map.
+  */
+  bool empty() const;
+
+  /**
+    The number of buckets elements are being put in.
+  */
+  size_t bucket_count() const;
+
+  /**
+    Map the key to the value, replacing any value it had.
+
+    @param  key     The key to map from
+    @param  value   The value to map to
+
+    @return True if the key was new to the map, otherwise false
+  */
+  bool insert(const K& key, const V& value);
+
+  /**
+    Look up the value a key maps to.
+
+    @param  key     The key to look up
+    @param  value   Where to copy the value, if there is one
+
+    @return True if the key was in the map, otherwise false
+  */
+  bool find(const K& key, V& value) const;
+
+  /**
+    Check if the key maps to anything.
+
+    @param  key     The key to look up
+  */
+  bool contains(const K& key) const;
+
+  /**
+    Delete the key and the value it maps to.
+
+    @param  key     The key to forget
+
+    @return True if the key was in the map, otherwise false
+  */
+  bool erase(const K& key);
+
+  /**
+    Call the closure on every key and value in the map.
+
+    Elements inserted or erased while this runs may or may not be
+    visited, but none is visited twice.
+
+    @param  closure   What to do with each key and value
+  */
+  void for_each(std::function<void(const K&, const V&)> closure) const;
+
+private:
+  static Element* moved_marker();
+  static Table* make_table(size_t bucket_count);
+  static void destroy_table(void* table);
+
+  std::mutex& stripe_for(size_t hash) const;
+
+  /**
+    Call the closure on every element of a bucket, from inside a guard,
+    following it to wherever it has been moved.
+  */
+  template<typename Closure>
+  static void visit_bucket(Table* table, size_t index, Closure& closure);
+
+  /**
+    Find the element with the key, from inside a guard.
+  */
+  Element* find_element(size_t hash, const K& key) const;
+
+  /**
+    The table writes for the hash go to, moving the bucket it used to be
+    in first if need be.  The caller holds the hash's stripe.
+  */
+  Table* writable_table(size_t hash);
+
+  /**
+    Move one bucket of the previous table into the current one.  The
+    caller holds the bucket's stripe.
+  */
+  void move_bucket(State* resize, size_t index);
+
+  /**
+    Move the next bucket no writer has claimed yet, if a resize is under
+    way.  The caller holds no stripe.
+  */
+  void help_resize();
+
+  void grow_if_full();
+};
+
+#include "ConcurrentHashMap.inl"
+
+} // namespace DataStructures
+
+#endif
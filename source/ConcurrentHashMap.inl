@@ -0,0 +1,330 @@
+// inlined in ConcurrentHashMap.h
+
+template<typename K, typename V, typename Hash, typename KeyEqual>
+DataStructures::ConcurrentHashMap<K, V, Hash, KeyEqual>::ConcurrentHashMap(
+  size_t bucket_count)
+  : number_of_elements(0)
+{
+  size_t rounded_bucket_count = stripe_count;
+  while (rounded_bucket_count < bucket_count)
+    rounded_bucket_count <<= 1;
+  state.store(new State{ make_table(rounded_bucket_count), nullptr, { 0 }, { 0 } },
+              std::memory_order_release);
+}
+
+template<typename K, typename V, typename Hash, typename KeyEqual>
+DataStructures::ConcurrentHashMap<K, V, Hash, KeyEqual>::~ConcurrentHashMap()
+{
+  State* last_state = state.load(std::memory_order_acquire);
+  for (Table* table : { last_state->current, last_state->previous }) {
+    if (table == nullptr)
+      continue;
+    for (size_t index = 0; index <= table->mask; ++index) {
+      Element* element = table->buckets[index].load(std::memory_order_relaxed);
+      if (element == moved_marker())
+        continue;
+      while (element != nullptr) {
+        Element* next = element->next.load(std::memory_order_relaxed);
+        delete element;
+        element = next;
+      }
+    }
+    destroy_table(table);
+  }
+  delete last_state;
+}
+
+template<typename K, typename V, typename Hash, typename KeyEqual>
+size_t
+DataStructures::ConcurrentHashMap<K, V, Hash, KeyEqual>::size() const
+{
+  return number_of_elements.load(std::memory_order_relaxed);
+}
+
+template<typename K, typename V, typename Hash, typename KeyEqual>
+bool
+DataStructures::ConcurrentHashMap<K, V, Hash, KeyEqual>::empty() const
+{
+  return size() == 0;
+}
+
+template<typename K, typename V, typename Hash, typename KeyEqual>
+size_t
+DataStructures::ConcurrentHashMap<K, V, Hash, KeyEqual>::bucket_count() const
+{
+  EpochReclamation::Guard guard{};
+  return state.load(std::memory_order_acquire)->current->mask + 1;
+}
+
+template<typename K, typename V, typename Hash, typename KeyEqual>
+bool
+DataStructures::ConcurrentHashMap<K, V, Hash, KeyEqual>::insert(const K& key,
+                                                                const V& value)
+{
+  EpochReclamation::Guard guard{};
+  help_resize();
+
+  size_t hash = hasher(key);
+  bool inserted;
+  {
+    std::lock_guard<std::mutex> lock{ stripe_for(hash) };
+    Table* table = writable_table(hash);
+    std::atomic<Element*>* link = &table->buckets[hash & table->mask];
+    Element* element = link->load(std::memory_order_relaxed);
+    while (element != nullptr &&
+           !(element->hash == hash && key_equal(element->key, key))) {
+      link = &element->next;
+      element = link->load(std::memory_order_relaxed);
+    }
+
+    // an element is never changed once readers can see it, so a new
+    // value means a new element in the old one's place
+    Element* next =
+      element == nullptr ? nullptr : element->next.load(std::memory_order_relaxed);
+    link->store(new Element{ key, value, hash, { next } },
+                std::memory_order_release);
+    inserted = element == nullptr;
+    if (!inserted)
+      EpochReclamation::retire(element);
+  }
+
+  if (inserted) {
+    number_of_elements.fetch_add(1, std::memory_order_relaxed);
+    grow_if_full();
+  }
+  return inserted;
+}
+
+template<typename K, typename V, typename Hash, typename KeyEqual>
+bool
+DataStructures::ConcurrentHashMap<K, V, Hash, KeyEqual>::find(const K& key,
+                                                              V& value) const
+{
+  EpochReclamation::Guard guard{};
+  Element* element = find_element(hasher(key), key);
+  if (element == nullptr)
+    return false;
+  value = element->value;
+  return true;
+}
+
+template<typename K, typename V, typename Hash, typename KeyEqual>
+bool
+DataStructures::ConcurrentHashMap<K, V, Hash, KeyEqual>::contains(
+  const K& key) const
+{
+  EpochReclamation::Guard guard{};
+  return find_element(hasher(key), key) != nullptr;
+}
+
+template<typename K, typename V, typename Hash, typename KeyEqual>
+bool
+DataStructures::ConcurrentHashMap<K, V, Hash, KeyEqual>::erase(const K& key)
+{
+  EpochReclamation::Guard guard{};
+  help_resize();
+
+  size_t hash = hasher(key);
+  std::lock_guard<std::mutex> lock{ stripe_for(hash) };
+  Table* table = writable_table(hash);
+  std::atomic<Element*>* link = &table->buckets[hash & table->mask];
+  Element* element = link->load(std::memory_order_relaxed);
+  while (element != nullptr) {
+    if (element->hash == hash && key_equal(element->key, key)) {
+      link->store(element->next.load(std::memory_order_relaxed),
+                  std::memory_order_release);
+      EpochReclamation::retire(element);
+      number_of_elements.fetch_sub(1, std::memory_order_relaxed);
+      return true;
+    }
+    link = &element->next;
+    element = link->load(std::memory_order_relaxed);
+  }
+  return false;
+}
+
+template<typename K, typename V, typename Hash, typename KeyEqual>
+void
+DataStructures::ConcurrentHashMap<K, V, Hash, KeyEqual>::for_each(
+  std::function<void(const K&, const V&)> closure) const
+{
+  EpochReclamation::Guard guard{};
+  State* resize = state.load(std::memory_order_acquire);
+  // a bucket of the smaller table is split between exactly two buckets
+  // of the larger one, so each element is found in one place or the
+  // other, never both
+  Table* table =
+    resize->previous != nullptr ? resize->previous : resize->current;
+  for (size_t index = 0; index <= table->mask; ++index)
+    visit_bucket(table, index, closure);
+}
+
+template<typename K, typename V, typename Hash, typename KeyEqual>
+template<typename Closure>
+void
+DataStructures::ConcurrentHashMap<K, V, Hash, KeyEqual>::visit_bucket(
+  Table* table,
+  size_t index,
+  Closure& closure)
+{
+  Element* element = table->buckets[index].load(std::memory_order_acquire);
+  if (element == moved_marker()) {
+    visit_bucket(table->successor, index, closure);
+    visit_bucket(table->successor, index + table->mask + 1, closure);
+    return;
+  }
+  for (; element != nullptr;
+       element = element->next.load(std::memory_order_acquire))
+    closure(element->key, element->value);
+}
+
+template<typename K, typename V, typename Hash, typename KeyEqual>
+typename ConcurrentHashMap<K, V, Hash, KeyEqual>::Element*
+DataStructures::ConcurrentHashMap<K, V, Hash, KeyEqual>::moved_marker()
+{
+  static char marker;
+  return reinterpret_cast<Element*>(&marker);
+}
+
+template<typename K, typename V, typename Hash, typename KeyEqual>
+typename ConcurrentHashMap<K, V, Hash, KeyEqual>::Table*
+DataStructures::ConcurrentHashMap<K, V, Hash, KeyEqual>::make_table(
+  size_t bucket_count)
+{
+  return new Table{ bucket_count - 1,
+                    new std::atomic<Element*>[bucket_count](),
+                    nullptr };
+}
+
+template<typename K, typename V, typename Hash, typename KeyEqual>
+void
+DataStructures::ConcurrentHashMap<K, V, Hash, KeyEqual>::destroy_table(
+  void* table)
+{
+  delete[] static_cast<Table*>(table)->buckets;
+  delete static_cast<Table*>(table);
+}
+
+template<typename K, typename V, typename Hash, typename KeyEqual>
+std::mutex&
+DataStructures::ConcurrentHashMap<K, V, Hash, KeyEqual>::stripe_for(
+  size_t hash) const
+{
+  // every table has a multiple of stripe_count buckets, so a bucket, the
+  // bucket it splits into on resize and every hash in them share a stripe
+  return stripes[hash % stripe_count].mutex;
+}
+
+template<typename K, typename V, typename Hash, typename KeyEqual>
+typename ConcurrentHashMap<K, V, Hash, KeyEqual>::Element*
+DataStructures::ConcurrentHashMap<K, V, Hash, KeyEqual>::find_element(
+  size_t hash,
+  const K& key) const
+{
+  // the state may be stale, with a resize having begun since that moved
+  // the bucket out of the table it calls current
+  State* resize = state.load(std::memory_order_acquire);
+  Table* table =
+    resize->previous != nullptr ? resize->previous : resize->current;
+  Element* element =
+    table->buckets[hash & table->mask].load(std::memory_order_acquire);
+  while (element == moved_marker()) {
+    table = table->successor;
+    element =
+      table->buckets[hash & table->mask].load(std::memory_order_acquire);
+  }
+
+  for (; element != nullptr;
+       element = element->next.load(std::memory_order_acquire))
+    if (element->hash == hash && key_equal(element->key, key))
+      return element;
+  return nullptr;
+}
+
+template<typename K, typename V, typename Hash, typename KeyEqual>
+typename ConcurrentHashMap<K, V, Hash, KeyEqual>::Table*
+DataStructures::ConcurrentHashMap<K, V, Hash, KeyEqual>::writable_table(
+  size_t hash)
+{
+  State* resize = state.load(std::memory_order_acquire);
+  if (resize->previous != nullptr)
+    move_bucket(resize, hash & resize->previous->mask);
+  return resize->current;
+}
+
+template<typename K, typename V, typename Hash, typename KeyEqual>
+void
+DataStructures::ConcurrentHashMap<K, V, Hash, KeyEqual>::move_bucket(
+  State* resize,
+  size_t index)
+{
+  std::atomic<Element*>& bucket = resize->previous->buckets[index];
+  Element* first = bucket.load(std::memory_order_relaxed);
+  if (first == moved_marker())
+    return;
+
+  // readers may be partway along the old chain, so it is copied rather
+  // than relinked and only retired once the marker turns readers away
+  Table* current = resize->current;
+  for (Element* element = first; element != nullptr;
+       element = element->next.load(std::memory_order_relaxed)) {
+    std::atomic<Element*>& destination =
+      current->buckets[element->hash & current->mask];
+    destination.store(
+      new Element{ element->key,
+                   element->value,
+                   element->hash,
+                   { destination.load(std::memory_order_relaxed) } },
+      std::memory_order_release);
+  }
+  bucket.store(moved_marker(), std::memory_order_release);
+  while (first != nullptr) {
+    Element* next = first->next.load(std::memory_order_relaxed);
+    EpochReclamation::retire(first);
+    first = next;
+  }
+
+  if (resize->moved.fetch_add(1, std::memory_order_acq_rel) + 1 <=
+      resize->previous->mask)
+    return;
+
+  // that was the last bucket, so the smaller table can go
+  std::lock_guard<std::mutex> lock{ resize_mutex };
+  state.store(new State{ current, nullptr, { 0 }, { 0 } },
+              std::memory_order_release);
+  EpochReclamation::retire(resize->previous, destroy_table);
+  EpochReclamation::retire(resize);
+}
+
+template<typename K, typename V, typename Hash, typename KeyEqual>
+void
+DataStructures::ConcurrentHashMap<K, V, Hash, KeyEqual>::help_resize()
+{
+  State* resize = state.load(std::memory_order_acquire);
+  if (resize->previous == nullptr)
+    return;
+  size_t index = resize->next_to_move.fetch_add(1, std::memory_order_relaxed);
+  if (index > resize->previous->mask)
+    return;
+  std::lock_guard<std::mutex> lock{ stripe_for(index) };
+  move_bucket(resize, index);
+}
+
+template<typename K, typename V, typename Hash, typename KeyEqual>
+void
+DataStructures::ConcurrentHashMap<K, V, Hash, KeyEqual>::grow_if_full()
+{
+  State* resize = state.load(std::memory_order_acquire);
+  if (resize->previous != nullptr ||
+      size() <= resize->current->mask + 1)
+    return;
+
+  std::lock_guard<std::mutex> lock{ resize_mutex };
+  if (state.load(std::memory_order_acquire) != resize)
+    return;
+  Table* larger = make_table(2 * (resize->current->mask + 1));
+  resize->current->successor = larger;
+  state.store(new State{ larger, resize->current, { 0 }, { 0 } },
+              std::memory_order_release);
+  EpochReclamation::retire(resize);
+}
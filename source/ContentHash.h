@@ -0,0 +1,127 @@
+#ifndef __DATA_STRUCTURES_CONTENT_HASH
+#define __DATA_STRUCTURES_CONTENT_HASH
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace DataStructures {
+
+/**
+  The `LinkedList` content hash policy that keeps nothing, so the list
+  pays nothing for hashing until asked for a hash.
+*/
+struct NoContentHash
+{
+  static constexpr bool maintained = false;
+
+  void reset() {}
+  void invalidate() {}
+  template<typename T>
+  void pushed_front(const T&)
+  {}
+  template<typename T>
+  void pushed_back(const T&)
+  {}
+  template<typename T>
+  void popped_front(const T&)
+  {}
+  template<typename T>
+  void popped_back(const T&)
+  {}
+  void begin_walk() {}
+  template<typename T>
+  void walked_past(const T&)
+  {}
+  template<typename T>
+  void removed_here(const T&)
+  {}
+};
+
+/**
+  The `LinkedList` content hash policy that keeps a polynomial hash of
+  the list up to date as it changes.
+
+  The hash is the sum of each element's hash times B to the power of its
+  position, modulo the prime 2^61 - 1, so adding or removing at either
+  end is O(1) and removing from the middle costs no more than finding
+  the element.  Changes it can't follow cheaply, like writing through a
+  reference from `front()`, mark it stale and it is worked out again the
+  next time it's needed.
+*/
+class RollingContentHash
+{
+public:
+  static constexpr bool maintained = true;
+
+private:
+  static constexpr uint64_t modulus = (uint64_t{ 1 } << 61) - 1;
+  static constexpr uint64_t base = 0x1f3d5b79a2c4e6f1 % modulus;
+
+  static constexpr uint64_t multiply(uint64_t a, uint64_t b);
+  static constexpr uint64_t add(uint64_t a, uint64_t b);
+  static constexpr uint64_t subtract(uint64_t a, uint64_t b);
+  static constexpr uint64_t power_of(uint64_t x, uint64_t exponent);
+
+  // worked out once the class is complete, so that power_of can be used
+  static const uint64_t base_inverse;
+
+  template<typename T>
+  static uint64_t element_hash(const T& datum);
+
+  uint64_t sum = 0;
+  // base to the power of the number of elements
+  uint64_t power = 1;
+  // the part of the sum for the elements a walk has gone past
+  uint64_t prefix = 0;
+  uint64_t prefix_power = 1;
+  bool stale = false;
+
+public:
+  /**
+    Check if the hash still matches the list.
+  */
+  bool current() const;
+
+  /**
+    The hash of the list, if it is current.
+  */
+  size_t value() const;
+
+  /**
+    Make it the hash of an empty list.
+  */
+  void reset();
+
+  /**
+    Mark the hash as no longer matching the list.
+  */
+  void invalidate();
+
+  template<typename T>
+  void pushed_front(const T& datum);
+  template<typename T>
+  void pushed_back(const T& datum);
+  template<typename T>
+  void popped_front(const T& datum);
+  template<typename T>
+  void popped_back(const T& datum);
+
+  /**
+    Note the start of a walk from the front of the list, which is told
+    about every element it passes and the one it removes.
+    {
+  */
+  void begin_walk();
+  template<typename T>
+  void walked_past(const T& datum);
+  template<typename T>
+  void removed_here(const T& datum);
+  /**}*/
+};
+
+#include "ContentHash.inl"
+
+} // namespace DataStructures
+
+#endif
@@ -0,0 +1,138 @@
+// inlined in ContentHash.h
+
+constexpr uint64_t
+DataStructures::RollingContentHash::multiply(uint64_t a, uint64_t b)
+{
+  __extension__ using uint128 = unsigned __int128;
+  uint128 product = static_cast<uint128>(a) * b;
+  // 2^61 is 1 modulo 2^61 - 1, so the high bits fold onto the low ones
+  uint64_t folded = static_cast<uint64_t>(product & modulus) +
+                    static_cast<uint64_t>(product >> 61);
+  return folded >= modulus ? folded - modulus : folded;
+}
+
+constexpr uint64_t
+DataStructures::RollingContentHash::add(uint64_t a, uint64_t b)
+{
+  uint64_t sum = a + b;
+  return sum >= modulus ? sum - modulus : sum;
+}
+
+constexpr uint64_t
+DataStructures::RollingContentHash::subtract(uint64_t a, uint64_t b)
+{
+  return a >= b ? a - b : a + modulus - b;
+}
+
+constexpr uint64_t
+DataStructures::RollingContentHash::power_of(uint64_t x, uint64_t exponent)
+{
+  uint64_t result = 1;
+  while (exponent > 0) {
+    if (exponent & 1)
+      result = multiply(result, x);
+    x = multiply(x, x);
+    exponent >>= 1;
+  }
+  return result;
+}
+
+// by Fermat's little theorem, as the modulus is prime
+inline constexpr uint64_t DataStructures::RollingContentHash::base_inverse =
+  power_of(base, modulus - 2);
+
+template<typename T>
+uint64_t
+DataStructures::RollingContentHash::element_hash(const T& datum)
+{
+  // std::hash is often the identity, so mix it before it's multiplied
+  uint64_t z = std::hash<T>{}(datum) + 0x9e3779b97f4a7c15;
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+  z ^= z >> 31;
+  return z % modulus;
+}
+
+inline bool
+DataStructures::RollingContentHash::current() const
+{
+  return !stale;
+}
+
+inline size_t
+DataStructures::RollingContentHash::value() const
+{
+  return static_cast<size_t>(sum);
+}
+
+inline void
+DataStructures::RollingContentHash::reset()
+{
+  sum = 0;
+  power = 1;
+  stale = false;
+}
+
+inline void
+DataStructures::RollingContentHash::invalidate()
+{
+  stale = true;
+}
+
+template<typename T>
+void
+DataStructures::RollingContentHash::pushed_front(const T& datum)
+{
+  sum = add(element_hash(datum), multiply(sum, base));
+  power = multiply(power, base);
+}
+
+template<typename T>
+void
+DataStructures::RollingContentHash::pushed_back(const T& datum)
+{
+  sum = add(sum, multiply(element_hash(datum), power));
+  power = multiply(power, base);
+}
+
+template<typename T>
+void
+DataStructures::RollingContentHash::popped_front(const T& datum)
+{
+  sum = multiply(subtract(sum, element_hash(datum)), base_inverse);
+  power = multiply(power, base_inverse);
+}
+
+template<typename T>
+void
+DataStructures::RollingContentHash::popped_back(const T& datum)
+{
+  power = multiply(power, base_inverse);
+  sum = subtract(sum, multiply(element_hash(datum), power));
+}
+
+inline void
+DataStructures::RollingContentHash::begin_walk()
+{
+  prefix = 0;
+  prefix_power = 1;
+}
+
+template<typename T>
+void
+DataStructures::RollingContentHash::walked_past(const T& datum)
+{
+  prefix = add(prefix, multiply(element_hash(datum), prefix_power));
+  prefix_power = multiply(prefix_power, base);
+}
+
+template<typename T>
+void
+DataStructures::RollingContentHash::removed_here(const T& datum)
+{
+  // everything after the removed element moves down one power of base
+  uint64_t suffix = subtract(
+    subtract(sum, prefix), multiply(element_hash(datum), prefix_power));
+  sum = add(prefix, multiply(suffix, base_inverse));
+  power = multiply(power, base_inverse);
+}
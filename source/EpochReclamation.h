@@ -0,0 +1,158 @@
+#ifndef __DATA_STRUCTURES_EPOCH_RECLAMATION
+#define __DATA_STRUCTURES_EPOCH_RECLAMATION
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace DataStructures {
+
+/**
+  Deferred freeing of memory that lock-free readers may still be
+  looking at.
+
+  A reader holds a `Guard` for as long as it follows pointers into a
+  shared structure.  A writer that unlinks something hands it to
+  `retire`, and it is only freed once every guard that existed at that
+  time is gone.  Entering and leaving a guard is a store and a fence on
+  a record only the current thread writes, never a read-modify-write.
+
+  There is one such domain for the whole process, shared by every
+  structure that uses it.
+*/
+class EpochReclamation
+{
+public:
+  /**
+    Marks the current thread as possibly looking at shared memory for
+    its lifetime.  Guards nest.
+  */
+  class Guard
+  {
+  public:
+    Guard();
+    ~Guard();
+    Guard(const Guard& other) = delete;
+    Guard& operator=(const Guard& other) = delete;
+  };
+
+  /**
+    Free the given object once no guard that could see it is left.
+
+    Each thread gathers what it retires and hands it over in batches of
+    `collection_threshold`, so that writers on different threads only
+    meet on a lock once per batch.  A batch is handed over early if its
+    oldest object could already be freed and nobody else is collecting.
+
+    The object must already be unreachable for readers that start now.
+
+    @param  garbage   An object allocated with `new`
+  */
+  template<typename T>
+  static void retire(T* garbage);
+
+  /**
+    Free the given memory once no guard that could see it is left.
+
+    @param  garbage   The memory to free
+    @param  deleter   How to free it
+  */
+  static void retire(void* garbage, void (*deleter)(void*));
+
+  /**
+    Hand over what the calling thread retired and free whatever no guard
+    can see any more, without waiting for the guards that can.
+
+    Meant for a writer that has just retired something large, or is
+    about to go quiet, and so shouldn't leave it for a batch to fill.
+  */
+  static void reclaim();
+
+  /**
+    Wait until everything retired so far by the calling thread, or by
+    threads that have ended, has been freed.
+
+    Must not be called while the calling thread holds a guard, or it
+    will wait forever.
+  */
+  static void synchronize();
+
+  /**
+    The number of retired objects that are not yet freed, apart from
+    those other running threads haven't handed over yet.
+  */
+  static size_t pending();
+
+  /**
+    How many retired objects a thread gathers before handing them over
+    and trying to free some.
+  */
+  static constexpr size_t collection_threshold = 64;
+
+private:
+  struct Garbage
+  {
+    void* pointer;
+    void (*deleter)(void*);
+    uint64_t epoch;
+  };
+
+  struct Record
+  {
+    // the epoch the owning thread entered its guard in, or 0 outside any
+    std::atomic<uint64_t> epoch;
+    std::atomic<bool> in_use;
+    Record* next;
+    // only touched by the owning thread
+    unsigned nesting;
+    // what the owning thread retired since it last handed a batch over
+    std::vector<Garbage> retired;
+  };
+
+  struct Domain
+  {
+    std::atomic<uint64_t> epoch;
+    std::atomic<Record*> records;
+    std::mutex garbage_mutex;
+    std::vector<Garbage> garbage;
+
+    Domain();
+    ~Domain();
+  };
+
+  /**
+    Hands over what the thread retired and releases its record for reuse
+    when the thread ends.
+  */
+  struct Registration
+  {
+    Record* record;
+
+    Registration();
+    ~Registration();
+  };
+
+  static Domain& domain();
+  static Record& local_record();
+
+  /**
+    Move what the record's thread retired into the domain's garbage.
+    The caller holds the garbage mutex.
+  */
+  static void hand_over(Domain& domain, Record& record);
+
+  /**
+    Move the global epoch forward if every guard has seen the current
+    one, then free what no guard can see any more.  The caller holds the
+    garbage mutex.
+  */
+  static void collect(Domain& domain);
+};
+
+#include "EpochReclamation.inl"
+
+} // namespace DataStructures
+
+#endif
@@ -0,0 +1,205 @@
+// inlined in EpochReclamation.h
+
+inline DataStructures::EpochReclamation::Guard::Guard()
+{
+  Record& record = local_record();
+  if (record.nesting++ > 0)
+    return;
+  record.epoch.store(domain().epoch.load(std::memory_order_acquire),
+                     std::memory_order_relaxed);
+  // the announcement has to be visible before any shared pointer is
+  // read, or a collector could miss this reader
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+inline DataStructures::EpochReclamation::Guard::~Guard()
+{
+  Record& record = local_record();
+  if (--record.nesting > 0)
+    return;
+  record.epoch.store(0, std::memory_order_release);
+}
+
+template<typename T>
+void
+DataStructures::EpochReclamation::retire(T* garbage)
+{
+  retire(garbage, [](void* pointer) { delete static_cast<T*>(pointer); });
+}
+
+inline void
+DataStructures::EpochReclamation::retire(void* garbage,
+                                         void (*deleter)(void*))
+{
+  Domain& the_domain = domain();
+  Record& record = local_record();
+  // the caller's unlinking store has to be visible before the epoch is
+  // read, or a stale epoch could be read while a reader that entered
+  // the next one still finds the garbage, which would then be freed
+  // under it; pairs with the fence in Guard
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  uint64_t epoch = the_domain.epoch.load(std::memory_order_relaxed);
+  record.retired.push_back(Garbage{ garbage, deleter, epoch });
+  if (record.retired.size() >= collection_threshold) {
+    std::lock_guard<std::mutex> lock{ the_domain.garbage_mutex };
+    hand_over(the_domain, record);
+    collect(the_domain);
+    return;
+  }
+
+  // a thread that retires rarely would otherwise sit on its first
+  // objects long after they could have gone
+  if (record.retired.front().epoch + 2 <= epoch) {
+    std::unique_lock<std::mutex> lock{ the_domain.garbage_mutex,
+                                       std::try_to_lock };
+    if (lock.owns_lock()) {
+      hand_over(the_domain, record);
+      collect(the_domain);
+    }
+  }
+}
+
+inline void
+DataStructures::EpochReclamation::reclaim()
+{
+  Domain& the_domain = domain();
+  Record& record = local_record();
+  std::lock_guard<std::mutex> lock{ the_domain.garbage_mutex };
+  hand_over(the_domain, record);
+  // what was just retired needs the epoch to move twice
+  collect(the_domain);
+  collect(the_domain);
+}
+
+inline void
+DataStructures::EpochReclamation::synchronize()
+{
+  Domain& the_domain = domain();
+  Record& record = local_record();
+  while (true) {
+    {
+      std::lock_guard<std::mutex> lock{ the_domain.garbage_mutex };
+      hand_over(the_domain, record);
+      collect(the_domain);
+      if (the_domain.garbage.empty())
+        return;
+    }
+    std::this_thread::yield();
+  }
+}
+
+inline size_t
+DataStructures::EpochReclamation::pending()
+{
+  Domain& the_domain = domain();
+  Record& record = local_record();
+  std::lock_guard<std::mutex> lock{ the_domain.garbage_mutex };
+  return the_domain.garbage.size() + record.retired.size();
+}
+
+inline DataStructures::EpochReclamation::Domain::Domain()
+  : epoch(1)
+  , records(nullptr)
+{}
+
+inline DataStructures::EpochReclamation::Domain::~Domain()
+{
+  // by now no thread can be in a guard, so everything can go
+  for (const Garbage& item : garbage)
+    item.deleter(item.pointer);
+  Record* record = records.load(std::memory_order_relaxed);
+  while (record != nullptr) {
+    Record* next = record->next;
+    delete record;
+    record = next;
+  }
+}
+
+inline DataStructures::EpochReclamation::Registration::Registration()
+{
+  Domain& the_domain = domain();
+  for (record = the_domain.records.load(std::memory_order_acquire);
+       record != nullptr;
+       record = record->next) {
+    bool was_in_use = false;
+    if (record->in_use.compare_exchange_strong(was_in_use, true))
+      return;
+  }
+  record = new Record{};
+  record->epoch.store(0, std::memory_order_relaxed);
+  record->in_use.store(true, std::memory_order_relaxed);
+  record->nesting = 0;
+  record->next = the_domain.records.load(std::memory_order_relaxed);
+  while (!the_domain.records.compare_exchange_weak(
+    record->next, record, std::memory_order_release)) {
+  }
+}
+
+inline DataStructures::EpochReclamation::Registration::~Registration()
+{
+  if (!record->retired.empty()) {
+    Domain& the_domain = domain();
+    std::lock_guard<std::mutex> lock{ the_domain.garbage_mutex };
+    hand_over(the_domain, *record);
+  }
+  record->in_use.store(false, std::memory_order_release);
+}
+
+inline DataStructures::EpochReclamation::Domain&
+DataStructures::EpochReclamation::domain()
+{
+  static Domain the_domain{};
+  return the_domain;
+}
+
+inline DataStructures::EpochReclamation::Record&
+DataStructures::EpochReclamation::local_record()
+{
+  // the domain is made first so that it outlives every registration
+  domain();
+  static thread_local Registration registration{};
+  return *registration.record;
+}
+
+inline void
+DataStructures::EpochReclamation::hand_over(Domain& domain, Record& record)
+{
+  domain.garbage.insert(
+    domain.garbage.end(), record.retired.begin(), record.retired.end());
+  record.retired.clear();
+}
+
+inline void
+DataStructures::EpochReclamation::collect(Domain& domain)
+{
+  // pairs with the fence in Guard so that every reader that could have
+  // seen something retired in an earlier epoch is seen here
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  uint64_t epoch = domain.epoch.load(std::memory_order_relaxed);
+  bool can_advance = true;
+  for (Record* record = domain.records.load(std::memory_order_acquire);
+       record != nullptr;
+       record = record->next) {
+    uint64_t record_epoch = record->epoch.load(std::memory_order_acquire);
+    if (record_epoch != 0 && record_epoch != epoch) {
+      can_advance = false;
+      break;
+    }
+  }
+  if (can_advance) {
+    epoch += 1;
+    domain.epoch.store(epoch, std::memory_order_release);
+  }
+
+  // whatever was retired two epochs ago was unlinked before any of the
+  // current readers entered their guards
+  auto kept = domain.garbage.begin();
+  for (auto item = domain.garbage.begin(); item != domain.garbage.end();
+       ++item) {
+    if (item->epoch + 2 <= epoch)
+      item->deleter(item->pointer);
+    else
+      *kept++ = *item;
+  }
+  domain.garbage.erase(kept, domain.garbage.end());
+}
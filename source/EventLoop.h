@@ -0,0 +1,134 @@
+#ifndef __DATA_STRUCTURES_EVENT_LOOP
+#define __DATA_STRUCTURES_EVENT_LOOP
+
+#include "RingQueue.h"
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+
+namespace DataStructures {
+
+/**
+  A single-threaded executor for coroutines.
+
+  Coroutines are resumed one after another, in the order they became
+  ready, on whichever thread calls `run`.  Nothing here is safe to use
+  from more than one thread.
+*/
+class EventLoop
+{
+public:
+  /**
+    The return type of a coroutine that is started with `spawn` and runs
+    to completion on the loop, with nobody waiting for its result.
+  */
+  class Task
+  {
+  public:
+    struct promise_type
+    {
+      // the loop the task was spawned on, which keeps a list of the
+      // tasks that haven't finished so it can destroy them
+      EventLoop* loop = nullptr;
+      promise_type* previous = nullptr;
+      promise_type* next = nullptr;
+
+      ~promise_type();
+      Task get_return_object();
+      std::suspend_always initial_suspend() noexcept;
+      std::suspend_never final_suspend() noexcept;
+      void return_void();
+      void unhandled_exception();
+    };
+
+  private:
+    std::coroutine_handle<promise_type> coroutine;
+    friend class EventLoop;
+
+    explicit Task(std::coroutine_handle<promise_type> coroutine);
+
+  public:
+    Task(Task&& other) noexcept;
+    Task(const Task& other) = delete;
+    Task& operator=(const Task& other) = delete;
+    Task& operator=(Task&& other) = delete;
+
+    /**
+      Destroy the coroutine if it was never spawned.
+    */
+    ~Task();
+  };
+
+  /**
+    The awaitable returned by `yield`.
+  */
+  struct YieldAwaiter
+  {
+    EventLoop& loop;
+
+    bool await_ready() const noexcept;
+    void await_suspend(std::coroutine_handle<> coroutine);
+    void await_resume() const noexcept;
+  };
+
+private:
+  RingQueue<std::coroutine_handle<>> ready;
+  Task::promise_type* tasks;
+
+public:
+  /**
+    Construct a loop with nothing to do.
+  */
+  EventLoop();
+
+  EventLoop(const EventLoop& other) = delete;
+  EventLoop& operator=(const EventLoop& other) = delete;
+
+  /**
+    Destroy the loop along with every task that hasn't finished.
+  */
+  ~EventLoop();
+
+  /**
+    Start a task the next time the loop runs.
+
+    @param  task  A call to a coroutine returning Task
+  */
+  void spawn(Task task);
+
+  /**
+    Resume a suspended coroutine the next time the loop runs.
+
+    @param  coroutine   The coroutine to resume
+  */
+  void schedule(std::coroutine_handle<> coroutine);
+
+  /**
+    Let every other ready coroutine run before carrying on.
+  */
+  YieldAwaiter yield();
+
+  /**
+    Resume ready coroutines until there are none.
+
+    @return The number of coroutines resumed
+  */
+  size_t run();
+
+  /**
+    Check if no coroutine is ready to be resumed.
+  */
+  bool idle() const;
+
+  /**
+    The number of spawned tasks that haven't finished.
+  */
+  size_t unfinished() const;
+};
+
+#include "EventLoop.inl"
+
+} // namespace DataStructures
+
+#endif
@@ -0,0 +1,138 @@
+// inlined in EventLoop.h
+
+inline DataStructures::EventLoop::Task::promise_type::~promise_type()
+{
+  if (loop == nullptr)
+    return;
+  if (previous != nullptr)
+    previous->next = next;
+  else
+    loop->tasks = next;
+  if (next != nullptr)
+    next->previous = previous;
+}
+
+inline DataStructures::EventLoop::Task
+DataStructures::EventLoop::Task::promise_type::get_return_object()
+{
+  return Task{ std::coroutine_handle<promise_type>::from_promise(*this) };
+}
+
+inline std::suspend_always
+DataStructures::EventLoop::Task::promise_type::initial_suspend() noexcept
+{
+  return {};
+}
+
+inline std::suspend_never
+DataStructures::EventLoop::Task::promise_type::final_suspend() noexcept
+{
+  return {};
+}
+
+inline void
+DataStructures::EventLoop::Task::promise_type::return_void()
+{}
+
+inline void
+DataStructures::EventLoop::Task::promise_type::unhandled_exception()
+{
+  // nobody is waiting on the task to hand the exception to
+  std::terminate();
+}
+
+inline DataStructures::EventLoop::Task::Task(
+  std::coroutine_handle<promise_type> coroutine)
+  : coroutine(coroutine)
+{}
+
+inline DataStructures::EventLoop::Task::Task(Task&& other) noexcept
+  : coroutine(other.coroutine)
+{
+  other.coroutine = nullptr;
+}
+
+inline DataStructures::EventLoop::Task::~Task()
+{
+  if (coroutine)
+    coroutine.destroy();
+}
+
+inline bool
+DataStructures::EventLoop::YieldAwaiter::await_ready() const noexcept
+{
+  return false;
+}
+
+inline void
+DataStructures::EventLoop::YieldAwaiter::await_suspend(
+  std::coroutine_handle<> coroutine)
+{
+  loop.schedule(coroutine);
+}
+
+inline void
+DataStructures::EventLoop::YieldAwaiter::await_resume() const noexcept
+{}
+
+inline DataStructures::EventLoop::EventLoop()
+  : ready(16, RingQueue<std::coroutine_handle<>>::FullPolicy::grow)
+  , tasks(nullptr)
+{}
+
+inline DataStructures::EventLoop::~EventLoop()
+{
+  while (tasks != nullptr)
+    std::coroutine_handle<Task::promise_type>::from_promise(*tasks).destroy();
+}
+
+inline void
+DataStructures::EventLoop::spawn(Task task)
+{
+  Task::promise_type& promise = task.coroutine.promise();
+  promise.loop = this;
+  promise.next = tasks;
+  if (tasks != nullptr)
+    tasks->previous = &promise;
+  tasks = &promise;
+  schedule(task.coroutine);
+  task.coroutine = nullptr;
+}
+
+inline void
+DataStructures::EventLoop::schedule(std::coroutine_handle<> coroutine)
+{
+  ready.push_back(coroutine);
+}
+
+inline DataStructures::EventLoop::YieldAwaiter
+DataStructures::EventLoop::yield()
+{
+  return YieldAwaiter{ *this };
+}
+
+inline size_t
+DataStructures::EventLoop::run()
+{
+  size_t resumed = 0;
+  while (!ready.empty()) {
+    ready.pop_front().resume();
+    resumed += 1;
+  }
+  return resumed;
+}
+
+inline bool
+DataStructures::EventLoop::idle() const
+{
+  return ready.empty();
+}
+
+inline size_t
+DataStructures::EventLoop::unfinished() const
+{
+  size_t count = 0;
+  for (Task::promise_type* task = tasks; task != nullptr; task = task->next)
+    count += 1;
+  return count;
+}
@@ -0,0 +1,105 @@
+#ifndef __DATA_STRUCTURES_GENERATOR
+#define __DATA_STRUCTURES_GENERATOR
+
+#include "LinkedList.h"
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <utility>
+
+namespace DataStructures {
+
+/**
+  A lazily evaluated sequence, produced by a coroutine that `co_yield`s
+  each value as it is asked for.
+*/
+template<typename T>
+class Generator
+{
+public:
+  struct promise_type
+  {
+    // valid from a co_yield until the coroutine is next resumed
+    const T* current = nullptr;
+    std::exception_ptr exception;
+
+    Generator get_return_object();
+    std::suspend_always initial_suspend() noexcept;
+    std::suspend_always final_suspend() noexcept;
+    std::suspend_always yield_value(const T& value);
+    void return_void();
+    void unhandled_exception();
+  };
+
+  /**
+    A type for iterating once through the generated values.
+  */
+  class iterator
+  {
+  public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+  private:
+    std::coroutine_handle<promise_type> coroutine;
+
+  public:
+    explicit iterator(std::coroutine_handle<promise_type> coroutine);
+    explicit iterator()
+      : coroutine(nullptr)
+    {}
+    iterator& operator++();
+    bool operator==(iterator other) const;
+    bool operator!=(iterator other) const;
+    const T& operator*() const;
+  };
+
+private:
+  std::coroutine_handle<promise_type> coroutine;
+
+  explicit Generator(std::coroutine_handle<promise_type> coroutine);
+
+public:
+  Generator(Generator&& other) noexcept;
+  Generator& operator=(Generator&& other) noexcept;
+  Generator(const Generator& other) = delete;
+  Generator& operator=(const Generator& other) = delete;
+
+  /**
+    Destroy the generator, abandoning whatever it hasn't produced yet.
+  */
+  ~Generator();
+
+  /**
+    Run the coroutine up to its first value and give an iterator there.
+    May only be called once.
+  */
+  iterator begin();
+
+  /**
+    An iterator to the terminus of the sequence.
+  */
+  iterator end();
+};
+
+/**
+  Produce the elements of a list one at a time, as they are asked for.
+
+  The list must outlive the generator and not change while it's in use.
+
+  @param  list  The list to stream
+*/
+template<typename T, typename ContentHash, typename Reclamation>
+Generator<T>
+stream(const LinkedList<T, ContentHash, Reclamation>& list);
+
+#include "Generator.inl"
+
+} // namespace DataStructures
+
+#endif
@@ -0,0 +1,138 @@
+// inlined in Generator.h
+
+template<typename T>
+Generator<T>
+DataStructures::Generator<T>::promise_type::get_return_object()
+{
+  return Generator{
+    std::coroutine_handle<promise_type>::from_promise(*this)
+  };
+}
+
+template<typename T>
+std::suspend_always
+DataStructures::Generator<T>::promise_type::initial_suspend() noexcept
+{
+  return {};
+}
+
+template<typename T>
+std::suspend_always
+DataStructures::Generator<T>::promise_type::final_suspend() noexcept
+{
+  return {};
+}
+
+template<typename T>
+std::suspend_always
+DataStructures::Generator<T>::promise_type::yield_value(const T& value)
+{
+  // the yielded value lives until the end of the co_yield expression,
+  // which is after the coroutine is resumed again
+  current = &value;
+  return {};
+}
+
+template<typename T>
+void
+DataStructures::Generator<T>::promise_type::return_void()
+{}
+
+template<typename T>
+void
+DataStructures::Generator<T>::promise_type::unhandled_exception()
+{
+  exception = std::current_exception();
+}
+
+template<typename T>
+DataStructures::Generator<T>::iterator::iterator(
+  std::coroutine_handle<promise_type> coroutine)
+  : coroutine(coroutine)
+{}
+
+template<typename T>
+typename Generator<T>::iterator&
+DataStructures::Generator<T>::iterator::operator++()
+{
+  coroutine.resume();
+  if (coroutine.done()) {
+    std::exception_ptr exception = coroutine.promise().exception;
+    coroutine = nullptr;
+    if (exception)
+      std::rethrow_exception(exception);
+  }
+  return *this;
+}
+
+template<typename T>
+bool
+DataStructures::Generator<T>::iterator::operator==(const iterator other) const
+{
+  return coroutine == other.coroutine;
+}
+
+template<typename T>
+bool
+DataStructures::Generator<T>::iterator::operator!=(const iterator other) const
+{
+  return coroutine != other.coroutine;
+}
+
+template<typename T>
+const T&
+DataStructures::Generator<T>::iterator::operator*() const
+{
+  return *coroutine.promise().current;
+}
+
+template<typename T>
+DataStructures::Generator<T>::Generator(
+  std::coroutine_handle<promise_type> coroutine)
+  : coroutine(coroutine)
+{}
+
+template<typename T>
+DataStructures::Generator<T>::Generator(Generator&& other) noexcept
+  : coroutine(other.coroutine)
+{
+  other.coroutine = nullptr;
+}
+
+template<typename T>
+Generator<T>&
+DataStructures::Generator<T>::operator=(Generator&& other) noexcept
+{
+  std::swap(coroutine, other.coroutine);
+  return *this;
+}
+
+template<typename T>
+DataStructures::Generator<T>::~Generator()
+{
+  if (coroutine)
+    coroutine.destroy();
+}
+
+template<typename T>
+typename Generator<T>::iterator
+DataStructures::Generator<T>::begin()
+{
+  iterator start{ coroutine };
+  return ++start;
+}
+
+template<typename T>
+typename Generator<T>::iterator
+DataStructures::Generator<T>::end()
+{
+  return iterator{};
+}
+
+template<typename T, typename ContentHash, typename Reclamation>
+Generator<T>
+stream(const LinkedList<T, ContentHash, Reclamation>& list)
+{
+  for (auto it = list.begin(); it != list.end(); ++it)
+    co_yield *it;
+}
@@ -1,13 +1,42 @@
 #ifndef __DATA_STRUCTURES_LINKED_LIST
 #define __DATA_STRUCTURES_LINKED_LIST
 
+#include "ContentHash.h"
+#include "NodeReclamation.h"
+
+#include <algorithm>
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
 #include <functional>
 #include <iterator>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace DataStructures {
 
-template<typename T>
+/**
+  A singly linked list.
+
+  The content hash policy decides whether the list keeps a hash of its
+  contents as it changes.  With the default, `NoContentHash`, it keeps
+  none and `hash()` walks the list; with `RollingContentHash`, `hash()`
+  is O(1) after most changes and lists with different contents are
+  usually told apart by `operator==` without walking them.
+
+  The reclamation policy decides how the elements are freed when the
+  list is cleared, assigned to or destroyed.  With the default,
+  `ImmediateReclamation`, that is done there and then, in O(n); with
+  `BackgroundReclamation` the elements are handed to another thread in
+  O(1).
+*/
+template<typename T,
+         typename ContentHash = NoContentHash,
+         typename Reclamation = ImmediateReclamation>
 class LinkedList
 {
 public:
@@ -27,15 +56,33 @@ private:
   Element* last;
   size_t number_of_elements;
 
+  // the element last reached by position and its index, so that walking
+  // the list by position resumes from there instead of from the start;
+  // null when no such element is known.  Only the non-const methods
+  // move it or refresh the content hash, so that const methods may be
+  // called from many threads at once, as with the standard containers
+  Element* finger;
+  size_t finger_index;
+
+  [[no_unique_address]] ContentHash content_hash;
+  [[no_unique_address]] Reclamation reclamation;
+
 public:
   /**
     A type for iterating forward through the list.
   */
-  class iterator : std::iterator<std::forward_iterator_tag, T>
+  class iterator
   {
   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T;
+
   private:
     Element* current;
+    friend class LinkedList;
 
   public:
     explicit iterator(Element* start);
@@ -75,6 +122,36 @@ public:
   */
   LinkedList(const LinkedList& other);
 
+  /**
+    Construct a copy of a list, building it in segments on several
+    threads at once and linking them together.
+
+    Each thread allocates the elements of its own segment, so that they
+    come from that thread's part of the heap.  Finding where the
+    segments start takes one walk of the other list on the calling
+    thread.  No more threads are used than the hardware runs at once, so
+    on one core this is the plain copy; the speedup on several cores
+    has not been measured.
+
+    @param  other     The list to copy
+    @param  threads   The number of threads to build on, counting the
+                      calling thread
+  */
+  LinkedList(const LinkedList& other, size_t threads);
+
+  /**
+    Construct the list from a range, building it in segments on several
+    threads at once and linking them together.  As with the parallel
+    copy, no more threads are used than the hardware runs at once.
+
+    @param  begin     The start of the range
+    @param  end       The end of the range
+    @param  threads   The number of threads to build on, counting the
+                      calling thread
+  */
+  template<std::random_access_iterator RandomIt>
+  LinkedList(RandomIt begin, RandomIt end, size_t threads);
+
   /**
     Move the list to a new place.
   */
@@ -110,14 +187,31 @@ public:
 
     @param  other   A list whose equality you're interested in
   */
-  bool operator==(const LinkedList<T>& other) const;
+  bool operator==(const LinkedList& other) const;
 
   /**
     Check if this and that list have inequal data.
 
     @param  other   A list whose inequality you're interested in
   */
-  bool operator!=(const LinkedList<T>& other) const;
+  bool operator!=(const LinkedList& other) const;
+
+  /**
+    A hash of the data in the list, in order, such that equal lists have
+    equal hashes whatever their content hash policy.
+
+    This is O(1) if the list keeps a content hash that is current, and
+    O(n) otherwise.  A content hash goes stale when the list is changed
+    in a way it can't follow, such as through a reference from `front()`,
+    `back()` or `at()`, or by `insert_at()`, `erase_at()` or
+    `insert_after()` anywhere but the front.  Only a non-const list
+    keeps the hash worked out for a stale content hash; a const one
+    walks the list again each time until it's changed.
+    {
+  */
+  size_t hash() const;
+  size_t hash();
+  /**}*/
 
   /**
     The value of the first item in the list.
@@ -179,6 +273,92 @@ public:
   */
   T pop_back();
 
+  /**
+    Remove up to n items from the front of the list, moving them to the
+    output in order.  The run is unlinked and freed as one batch.
+
+    @param  n     The most items to remove
+    @param  out   Where to move the items to
+
+    @return The number of items removed
+  */
+  template<typename OutputIt>
+  size_t pop_front_n(size_t n, OutputIt out);
+
+  /**
+    Remove every item from the list, moving them to the output in order.
+
+    @param  out   Where to move the items to
+
+    @return The number of items removed
+  */
+  template<typename OutputIt>
+  size_t drain(OutputIt out);
+
+  /**
+    Remove up to n items from the front of the list, keeping them in
+    order in a list of their own.  No element is copied or freed.
+
+    @param  n   The most items to remove
+
+    @return A list of the items removed
+  */
+  LinkedList take_front(size_t n);
+
+  /**
+    The value at the given position in the list.
+
+    Positions are reached by walking forward from the last position
+    asked for of a non-const list, so visiting them in ascending order
+    costs amortized O(1) each; the const overload starts from there too
+    but leaves it be.  Should the position be past the end of the list,
+    this method will result in undefined behaviour, likely a crash.
+
+    @param  index   How many elements precede the one wanted
+
+    @return The datum at that position
+    {
+  */
+  T& at(size_t index);
+  const T& at(size_t index) const;
+  /**}*/
+
+  /**
+    Add the given value so that it ends up at the given position.
+
+    Should the position be past the end of the list, this method will
+    result in undefined behaviour, likely a crash.
+
+    @param  index       How many elements will precede the new one
+    @param  new_value   The datum to be added to the list
+  */
+  void insert_at(size_t index, const T& new_value);
+
+  /**
+    Remove the item at the given position from the list and return it.
+
+    Should the position be past the end of the list, this method will
+    result in undefined behaviour, likely a crash.
+
+    @param  index   How many elements precede the one to be removed
+
+    @return The datum formerly at that position
+  */
+  T erase_at(size_t index);
+
+  /**
+    Add the given value right after the element the iterator is at.
+
+    Should the iterator be end(), this method will result in undefined
+    behaviour, likely a crash.
+
+    @param  position    An iterator into this list
+    @param  new_value   The datum to be added to the list
+
+    @return An iterator to the new element
+  */
+  iterator insert_after(iterator position, const T& new_value);
+
   /**
     Remove all elements from the list.
   */
@@ -199,28 +379,91 @@ public:
     @param closure  A function representing the desired mutation
   */
   void map(std::function<T(const T&)> closure);
+
+private:
+  /**
+    Find the element at the given position, starting from the finger if
+    it isn't past it.
+  */
+  Element* walk_to(size_t index) const;
+
+  /**
+    Find the element at the given position, remembering it as the
+    finger.
+  */
+  Element* seek(size_t index);
+
+  /**
+    Make the list start at rest, after the first count elements were
+    taken away.
+  */
+  void detach_front(Element* rest, size_t count);
+
+  /**
+    Free up to budget elements of a chain, returning the rest of it.
+  */
+  static void* free_elements(void* chain, size_t budget);
+
+  /**
+    How many segments to build length elements in, given the number of
+    threads asked for.
+  */
+  static size_t segments_for(size_t threads, size_t length);
+
+  /**
+    Copy count elements starting at source into a new chain.
+  */
+  template<typename InputIt>
+  static void copy_segment(InputIt source,
+                           size_t count,
+                           Element*& segment_first,
+                           Element*& segment_last);
+
+  /**
+    Build this list out of the segments of a source with the given
+    starts and lengths, one thread to a segment.
+  */
+  template<typename InputIt>
+  void build_segments(const std::vector<InputIt>& starts,
+                      const std::vector<size_t>& counts);
 };
 
-template<typename T>
+template<typename T, typename ContentHash, typename Reclamation>
 bool
-operator==(const LinkedList<T>& a, const LinkedList<T>& b);
+operator==(const LinkedList<T, ContentHash, Reclamation>& a,
+           const LinkedList<T, ContentHash, Reclamation>& b);
 
-template<typename T>
+template<typename T, typename ContentHash, typename Reclamation>
 bool
-operator!=(const LinkedList<T>& a, const LinkedList<T>& b);
+operator!=(const LinkedList<T, ContentHash, Reclamation>& a,
+           const LinkedList<T, ContentHash, Reclamation>& b);
 
-template<typename T>
+template<typename T, typename ContentHash, typename Reclamation>
 bool
-operator==(typename LinkedList<T>::iterator a,
-           typename LinkedList<T>::iterator b);
+operator==(typename LinkedList<T, ContentHash, Reclamation>::iterator a,
+           typename LinkedList<T, ContentHash, Reclamation>::iterator b);
 
-template<typename T>
+template<typename T, typename ContentHash, typename Reclamation>
 bool
-operator!=(typename LinkedList<T>::iterator a,
-           typename LinkedList<T>::iterator b);
+operator!=(typename LinkedList<T, ContentHash, Reclamation>::iterator a,
+           typename LinkedList<T, ContentHash, Reclamation>::iterator b);
 
 #include "LinkedList.inl"
 
 } // namespace DataStructures
 
+namespace std {
+
+template<typename T, typename ContentHash, typename Reclamation>
+struct hash<DataStructures::LinkedList<T, ContentHash, Reclamation>>
+{
+  size_t operator()(
+    const DataStructures::LinkedList<T, ContentHash, Reclamation>& list) const
+  {
+    return list.hash();
+  }
+};
+
+} // namespace std
+
 #endif
@@ -1,60 +1,67 @@
 // inlined in LinkedList.h
 
-template<typename T>
-DataStructures::LinkedList<T>::iterator::iterator(Element* start)
+template<typename T, typename ContentHash, typename Reclamation>
+DataStructures::LinkedList<T, ContentHash, Reclamation>::iterator::iterator(
+  Element* start)
 {
   current = start;
 }
 
-template<typename T>
-typename LinkedList<T>::iterator&
-DataStructures::LinkedList<T>::iterator::operator++()
+template<typename T, typename ContentHash, typename Reclamation>
+typename LinkedList<T, ContentHash, Reclamation>::iterator&
+DataStructures::LinkedList<T, ContentHash, Reclamation>::iterator::operator++()
 {
   current = current->next;
   return *this;
 }
 
-template<typename T>
+template<typename T, typename ContentHash, typename Reclamation>
 bool
-DataStructures::LinkedList<T>::iterator::operator==(const iterator other) const
+DataStructures::LinkedList<T, ContentHash, Reclamation>::iterator::operator==(
+  const iterator other) const
 {
   return current == other.current;
 }
 
-template<typename T>
+template<typename T, typename ContentHash, typename Reclamation>
 bool
-DataStructures::LinkedList<T>::iterator::operator!=(const iterator other) const
+DataStructures::LinkedList<T, ContentHash, Reclamation>::iterator::operator!=(
+  const iterator other) const
 {
   return current != other.current;
 }
 
-template<typename T>
+template<typename T, typename ContentHash, typename Reclamation>
 T
-DataStructures::LinkedList<T>::iterator::operator*() const
+DataStructures::LinkedList<T, ContentHash, Reclamation>::iterator::operator*()
+  const
 {
   return current->datum;
 }
 
-template<typename T>
-typename LinkedList<T>::iterator
-DataStructures::LinkedList<T>::begin() const
+template<typename T, typename ContentHash, typename Reclamation>
+typename LinkedList<T, ContentHash, Reclamation>::iterator
+DataStructures::LinkedList<T, ContentHash, Reclamation>::begin() const
 {
-  LinkedList<T>::iterator begin{ first };
+  LinkedList<T, ContentHash, Reclamation>::iterator begin{ first };
   return begin;
 }
 
-template<typename T>
-typename LinkedList<T>::iterator
-DataStructures::LinkedList<T>::end() const
+template<typename T, typename ContentHash, typename Reclamation>
+typename LinkedList<T, ContentHash, Reclamation>::iterator
+DataStructures::LinkedList<T, ContentHash, Reclamation>::end() const
 {
-  return LinkedList<T>::iterator{};
+  return LinkedList<T, ContentHash, Reclamation>::iterator{};
 }
 
-template<typename T>
-DataStructures::LinkedList<T>::LinkedList(std::initializer_list<T> contents)
+template<typename T, typename ContentHash, typename Reclamation>
+DataStructures::LinkedList<T, ContentHash, Reclamation>::LinkedList(
+  std::initializer_list<T> contents)
 {
   number_of_elements = contents.size();
   last = nullptr;
+  finger = nullptr;
+  finger_index = 0;
 
   Element* next = nullptr;
   for (auto it = std::crbegin(contents); it != std::crend(contents); ++it) {
@@ -62,34 +69,94 @@ DataStructures::LinkedList<T>::LinkedList(std::initializer_list<T> contents)
     if (last == nullptr)
       last = current;
     next = current;
+    content_hash.pushed_front(*it);
   }
   first = next;
 }
 
-template<typename T>
-DataStructures::LinkedList<T>::LinkedList()
+template<typename T, typename ContentHash, typename Reclamation>
+DataStructures::LinkedList<T, ContentHash, Reclamation>::LinkedList()
 {
   number_of_elements = 0;
   first = nullptr;
   last = nullptr;
+  finger = nullptr;
+  finger_index = 0;
 }
 
-template<typename T>
-DataStructures::LinkedList<T>::LinkedList(const LinkedList& other)
+template<typename T, typename ContentHash, typename Reclamation>
+DataStructures::LinkedList<T, ContentHash, Reclamation>::LinkedList(
+  const LinkedList& other)
 {
   number_of_elements = 0;
+  finger = nullptr;
+  finger_index = 0;
   *this = other;
 }
 
-template<typename T>
-LinkedList<T>&
-DataStructures::LinkedList<T>::operator=(const LinkedList& other)
+template<typename T, typename ContentHash, typename Reclamation>
+DataStructures::LinkedList<T, ContentHash, Reclamation>::LinkedList(
+  const LinkedList& other,
+  size_t threads)
+  : LinkedList()
+{
+  size_t segments = segments_for(threads, other.size());
+  if (segments <= 1) {
+    *this = other;
+    return;
+  }
+  std::vector<iterator> starts{};
+  std::vector<size_t> counts{};
+  Element* start = other.first;
+  size_t position = 0;
+  for (size_t segment = 0; segment < segments; ++segment) {
+    size_t count = (other.size() - position) / (segments - segment);
+    starts.push_back(iterator{ start });
+    counts.push_back(count);
+    position += count;
+    if (segment + 1 < segments)
+      for (size_t i = 0; i < count; ++i)
+        start = start->next;
+  }
+  build_segments(starts, counts);
+  content_hash = other.content_hash;
+}
+
+template<typename T, typename ContentHash, typename Reclamation>
+template<std::random_access_iterator RandomIt>
+DataStructures::LinkedList<T, ContentHash, Reclamation>::LinkedList(
+  RandomIt begin,
+  RandomIt end,
+  size_t threads)
+  : LinkedList()
+{
+  size_t length = static_cast<size_t>(end - begin);
+  size_t segments = segments_for(threads, length);
+  std::vector<RandomIt> starts{};
+  std::vector<size_t> counts{};
+  size_t position = 0;
+  for (size_t segment = 0; segment < segments; ++segment) {
+    size_t count = (length - position) / (segments - segment);
+    starts.push_back(begin + position);
+    counts.push_back(count);
+    position += count;
+  }
+  build_segments(starts, counts);
+  // hashing the range would take a walk on one thread, so it is left
+  // until it is asked for
+  content_hash.invalidate();
+}
+
+template<typename T, typename ContentHash, typename Reclamation>
+LinkedList<T, ContentHash, Reclamation>&
+DataStructures::LinkedList<T, ContentHash, Reclamation>::operator=(
+  const LinkedList& other)
 {
   if (!empty())
     clear();
   first = nullptr;
   number_of_elements = other.size();
-  Element* previous;
+  Element* previous = nullptr;
   for (auto it = other.begin(); it != other.end(); ++it) {
     Element* next = new Element{ *it, nullptr };
     if (first == nullptr) {
@@ -100,24 +167,33 @@ DataStructures::LinkedList<T>::operator=(const LinkedList& other)
     previous = next;
   }
   last = previous;
+  content_hash = other.content_hash;
   return *this;
 }
 
-template<typename T>
-DataStructures::LinkedList<T>::LinkedList(LinkedList&& other) noexcept
+template<typename T, typename ContentHash, typename Reclamation>
+DataStructures::LinkedList<T, ContentHash, Reclamation>::LinkedList(
+  LinkedList&& other) noexcept
 {
   first = other.first;
   last = other.last;
   number_of_elements = other.number_of_elements;
+  finger = other.finger;
+  finger_index = other.finger_index;
+  content_hash = other.content_hash;
 
   other.first = nullptr;
   other.last = nullptr;
   other.number_of_elements = 0;
+  other.finger = nullptr;
+  other.finger_index = 0;
+  other.content_hash.reset();
 }
 
-template<typename T>
-LinkedList<T>&
-DataStructures::LinkedList<T>::operator=(LinkedList&& other) noexcept
+template<typename T, typename ContentHash, typename Reclamation>
+LinkedList<T, ContentHash, Reclamation>&
+DataStructures::LinkedList<T, ContentHash, Reclamation>::operator=(
+  LinkedList&& other) noexcept
 {
   if (this == &other)
     return *this;
@@ -134,35 +210,46 @@ DataStructures::LinkedList<T>::operator=(LinkedList&& other) noexcept
   last = new_last;
   number_of_elements = new_number_of_elements;
 
+  std::swap(finger, other.finger);
+  std::swap(finger_index, other.finger_index);
+  std::swap(content_hash, other.content_hash);
+
   return *this;
 }
 
-template<typename T>
-DataStructures::LinkedList<T>::~LinkedList()
+template<typename T, typename ContentHash, typename Reclamation>
+DataStructures::LinkedList<T, ContentHash, Reclamation>::~LinkedList()
 {
   clear();
 }
 
-template<typename T>
+template<typename T, typename ContentHash, typename Reclamation>
 size_t
-DataStructures::LinkedList<T>::size() const
+DataStructures::LinkedList<T, ContentHash, Reclamation>::size() const
 {
   return number_of_elements;
 }
 
-template<typename T>
+template<typename T, typename ContentHash, typename Reclamation>
 bool
-DataStructures::LinkedList<T>::empty() const
+DataStructures::LinkedList<T, ContentHash, Reclamation>::empty() const
 {
   return number_of_elements == 0;
 }
 
-template<typename T>
+template<typename T, typename ContentHash, typename Reclamation>
 bool
-DataStructures::LinkedList<T>::operator==(const LinkedList<T>& other) const
+DataStructures::LinkedList<T, ContentHash, Reclamation>::operator==(
+  const LinkedList& other) const
 {
   if (other.size() != number_of_elements)
     return false;
+  // a stale hash would cost as much to work out as the comparison
+  if constexpr (ContentHash::maintained) {
+    if (content_hash.current() && other.content_hash.current() &&
+        content_hash.value() != other.content_hash.value())
+      return false;
+  }
 
   auto this_it = begin();
   auto other_it = other.begin();
@@ -175,57 +262,67 @@ DataStructures::LinkedList<T>::operator==(const LinkedList<T>& other) const
   return true;
 }
 
-template<typename T>
+template<typename T, typename ContentHash, typename Reclamation>
 bool
-DataStructures::LinkedList<T>::operator!=(const LinkedList<T>& other) const
+DataStructures::LinkedList<T, ContentHash, Reclamation>::operator!=(
+  const LinkedList& other) const
 {
   return !operator==(other);
 }
 
-template<typename T>
+template<typename T, typename ContentHash, typename Reclamation>
 T&
-DataStructures::LinkedList<T>::front()
+DataStructures::LinkedList<T, ContentHash, Reclamation>::front()
 {
   assert(!empty());
+  content_hash.invalidate();
   return first->datum;
 }
 
-template<typename T>
+template<typename T, typename ContentHash, typename Reclamation>
 const T&
-DataStructures::LinkedList<T>::cfront() const
+DataStructures::LinkedList<T, ContentHash, Reclamation>::cfront() const
 {
   assert(!empty());
   return first->datum;
 }
 
-template<typename T>
+template<typename T, typename ContentHash, typename Reclamation>
 T&
-DataStructures::LinkedList<T>::back()
+DataStructures::LinkedList<T, ContentHash, Reclamation>::back()
 {
   assert(!empty());
+  content_hash.invalidate();
   return last->datum;
 }
 
-template<typename T>
+template<typename T, typename ContentHash, typename Reclamation>
 const T&
-DataStructures::LinkedList<T>::cback() const
+DataStructures::LinkedList<T, ContentHash, Reclamation>::cback() const
 {
   assert(!empty());
   return last->datum;
 }
 
-template<typename T>
+template<typename T, typename ContentHash, typename Reclamation>
 void
-DataStructures::LinkedList<T>::push_front(const T& new_value)
+DataStructures::LinkedList<T, ContentHash, Reclamation>::push_front(
+  const T& new_value)
 {
   number_of_elements += 1;
   Element* new_first = new Element{ new_value, first };
+  if (first == nullptr)
+    last = new_first;
   first = new_first;
+  if (finger != nullptr)
+    finger_index += 1;
+  content_hash.pushed_front(new_value);
 }
 
-template<typename T>
+template<typename T, typename ContentHash, typename Reclamation>
 void
-DataStructures::LinkedList<T>::push_back(const T& new_value)
+DataStructures::LinkedList<T, ContentHash, Reclamation>::push_back(
+  const T& new_value)
 {
   Element* new_last = new Element{ new_value, nullptr };
   if (!empty())
@@ -234,25 +331,124 @@ DataStructures::LinkedList<T>::push_back(const T& new_value)
     first = new_last;
   last = new_last;
   number_of_elements += 1;
+  content_hash.pushed_back(new_value);
 }
 
-template<typename T>
+template<typename T, typename ContentHash, typename Reclamation>
 T
-DataStructures::LinkedList<T>::pop_front()
+DataStructures::LinkedList<T, ContentHash, Reclamation>::pop_front()
 {
   assert(!empty());
   Element* old_first = first;
   first = first->next;
+  if (first == nullptr)
+    last = nullptr;
   number_of_elements -= 1;
+  if (finger == old_first)
+    finger = nullptr;
+  else if (finger != nullptr)
+    finger_index -= 1;
   T old_first_datum = old_first->datum;
+  content_hash.popped_front(old_first_datum);
   delete old_first;
   old_first = nullptr;
   return old_first_datum;
 }
 
-template<typename T>
+template<typename T, typename ContentHash, typename Reclamation>
+template<typename OutputIt>
+size_t
+DataStructures::LinkedList<T, ContentHash, Reclamation>::pop_front_n(
+  size_t n,
+  OutputIt out)
+{
+  constexpr bool immediate =
+    std::is_same<Reclamation, ImmediateReclamation>::value;
+  size_t count = std::min(n, number_of_elements);
+  if (count == 0)
+    return 0;
+  Element* chain = first;
+  Element* current = first;
+  Element* tail = nullptr;
+  for (size_t i = 0; i < count; ++i) {
+    content_hash.popped_front(current->datum);
+    *out = std::move(current->datum);
+    ++out;
+    tail = current;
+    current = current->next;
+    // freeing each element once it has been passed saves walking the
+    // run a second time to free it
+    if constexpr (immediate)
+      delete tail;
+  }
+  detach_front(current, count);
+  if constexpr (!immediate) {
+    tail->next = nullptr;
+    reclamation.dispose(chain, count, free_elements);
+  }
+  return count;
+}
+
+template<typename T, typename ContentHash, typename Reclamation>
+template<typename OutputIt>
+size_t
+DataStructures::LinkedList<T, ContentHash, Reclamation>::drain(OutputIt out)
+{
+  size_t count = number_of_elements;
+  if constexpr (std::is_same<Reclamation, ImmediateReclamation>::value) {
+    Element* current = first;
+    while (current != nullptr) {
+      *out = std::move(current->datum);
+      ++out;
+      Element* next = current->next;
+      delete current;
+      current = next;
+    }
+    first = nullptr;
+    last = nullptr;
+    number_of_elements = 0;
+    finger = nullptr;
+    content_hash.reset();
+  } else {
+    for (Element* element = first; element != nullptr;
+         element = element->next) {
+      *out = std::move(element->datum);
+      ++out;
+    }
+    // the moved-from data are freed along with the elements
+    clear();
+  }
+  return count;
+}
+
+template<typename T, typename ContentHash, typename Reclamation>
+LinkedList<T, ContentHash, Reclamation>
+DataStructures::LinkedList<T, ContentHash, Reclamation>::take_front(size_t n)
+{
+  LinkedList taken{};
+  size_t count = std::min(n, number_of_elements);
+  if (count == 0)
+    return taken;
+  Element* tail = first;
+  for (size_t i = 1;; ++i) {
+    content_hash.popped_front(tail->datum);
+    taken.content_hash.pushed_back(tail->datum);
+    if (i == count)
+      break;
+    tail = tail->next;
+  }
+  taken.first = first;
+  taken.last = tail;
+  taken.number_of_elements = count;
+  Element* rest = tail->next;
+  tail->next = nullptr;
+  detach_front(rest, count);
+  return taken;
+}
+
+template<typename T, typename ContentHash, typename Reclamation>
 T
-DataStructures::LinkedList<T>::pop_back()
+DataStructures::LinkedList<T, ContentHash, Reclamation>::pop_back()
 {
   assert(!empty());
   T old_last_datum;
@@ -260,7 +456,10 @@ DataStructures::LinkedList<T>::pop_back()
     old_last_datum = first->datum;
     delete first;
     first = nullptr;
+    last = nullptr;
+    finger = nullptr;
     number_of_elements -= 1;
+    content_hash.popped_back(old_last_datum);
     return old_last_datum;
   }
 
@@ -269,94 +468,378 @@ DataStructures::LinkedList<T>::pop_back()
     new_last = new_last->next;
   }
   old_last_datum = last->datum;
+  if (finger == last)
+    finger = nullptr;
   delete last;
   new_last->next = nullptr;
   last = new_last;
   number_of_elements -= 1;
+  content_hash.popped_back(old_last_datum);
   return old_last_datum;
 }
 
-template<typename T>
-void
-DataStructures::LinkedList<T>::clear()
+template<typename T, typename ContentHash, typename Reclamation>
+T&
+DataStructures::LinkedList<T, ContentHash, Reclamation>::at(size_t index)
 {
-  Element* current = first;
-  while (current != nullptr) {
-    Element* next = current->next;
-    current->next = nullptr;
-    delete current;
-    current = next;
+  content_hash.invalidate();
+  return seek(index)->datum;
+}
+
+template<typename T, typename ContentHash, typename Reclamation>
+const T&
+DataStructures::LinkedList<T, ContentHash, Reclamation>::at(size_t index) const
+{
+  return walk_to(index)->datum;
+}
+
+template<typename T, typename ContentHash, typename Reclamation>
+void
+DataStructures::LinkedList<T, ContentHash, Reclamation>::insert_at(
+  size_t index,
+  const T& new_value)
+{
+  assert(index <= number_of_elements);
+  if (index == 0) {
+    push_front(new_value);
+    return;
   }
+  Element* previous_element = seek(index - 1);
+  Element* new_element = new Element{ new_value, previous_element->next };
+  previous_element->next = new_element;
+  if (previous_element == last)
+    last = new_element;
+  number_of_elements += 1;
+  finger = new_element;
+  finger_index = index;
+  content_hash.invalidate();
+}
+
+template<typename T, typename ContentHash, typename Reclamation>
+T
+DataStructures::LinkedList<T, ContentHash, Reclamation>::erase_at(size_t index)
+{
+  assert(index < number_of_elements);
+  if (index == 0)
+    return pop_front();
+  Element* previous_element = seek(index - 1);
+  Element* old_element = previous_element->next;
+  previous_element->next = old_element->next;
+  if (old_element == last)
+    last = previous_element;
+  number_of_elements -= 1;
+  content_hash.invalidate();
+  T old_datum = old_element->datum;
+  delete old_element;
+  return old_datum;
+}
+
+template<typename T, typename ContentHash, typename Reclamation>
+typename LinkedList<T, ContentHash, Reclamation>::iterator
+DataStructures::LinkedList<T, ContentHash, Reclamation>::insert_after(
+  iterator position,
+  const T& new_value)
+{
+  Element* previous_element = position.current;
+  assert(previous_element != nullptr);
+  Element* new_element = new Element{ new_value, previous_element->next };
+  previous_element->next = new_element;
+  if (previous_element == last)
+    last = new_element;
+  number_of_elements += 1;
+  // there's no telling whether the finger was behind the new element
+  // without walking to it, unless it was the very element before it
+  if (finger != previous_element)
+    finger = nullptr;
+  content_hash.invalidate();
+  return iterator{ new_element };
+}
+
+template<typename T, typename ContentHash, typename Reclamation>
+void
+DataStructures::LinkedList<T, ContentHash, Reclamation>::clear()
+{
+  Element* chain = first;
+  size_t chain_length = number_of_elements;
   first = nullptr;
   last = nullptr;
   number_of_elements = 0;
+  finger = nullptr;
+  content_hash.reset();
+  // the list is already empty, so it makes no difference to it how long
+  // the chain takes to go
+  if (chain != nullptr)
+    reclamation.dispose(chain, chain_length, free_elements);
 }
 
-template<typename T>
+template<typename T, typename ContentHash, typename Reclamation>
 bool
-DataStructures::LinkedList<T>::remove(const T& value)
+DataStructures::LinkedList<T, ContentHash, Reclamation>::remove(const T& value)
 {
   if (empty())
     return false;
   if (first->datum == value) {
-    Element* old_first = first;
-    first = first->next;
-    delete old_first;
-    number_of_elements -= 1;
+    pop_front();
     return true;
   }
   Element* previous_element = first;
   Element* current_element = first->next;
+  size_t current_index = 1;
+  content_hash.begin_walk();
+  content_hash.walked_past(first->datum);
   while (current_element != nullptr) {
     if (current_element->datum == value) {
+      content_hash.removed_here(current_element->datum);
       previous_element->next = current_element->next;
+      if (current_element == last)
+        last = previous_element;
+      if (finger == current_element)
+        finger = nullptr;
+      else if (finger != nullptr && finger_index > current_index)
+        finger_index -= 1;
       delete current_element;
       number_of_elements -= 1;
       return true;
     }
+    content_hash.walked_past(current_element->datum);
     previous_element = current_element;
     current_element = current_element->next;
+    current_index += 1;
   }
   return false;
 }
 
-template<typename T>
+template<typename T, typename ContentHash, typename Reclamation>
 void
-DataStructures::LinkedList<T>::map(std::function<T(const T&)> closure)
+DataStructures::LinkedList<T, ContentHash, Reclamation>::map(
+  std::function<T(const T&)> closure)
 {
+  content_hash.reset();
   Element* current_element = first;
   while (current_element != nullptr) {
     current_element->datum = closure(current_element->datum);
+    content_hash.pushed_back(current_element->datum);
     current_element = current_element->next;
   }
 }
 
-template<typename T>
+template<typename T, typename ContentHash, typename Reclamation>
+size_t
+DataStructures::LinkedList<T, ContentHash, Reclamation>::hash() const
+{
+  if constexpr (ContentHash::maintained) {
+    if (content_hash.current())
+      return content_hash.value();
+  }
+  RollingContentHash scratch{};
+  for (Element* element = first; element != nullptr; element = element->next)
+    scratch.pushed_back(element->datum);
+  return scratch.value();
+}
+
+template<typename T, typename ContentHash, typename Reclamation>
+size_t
+DataStructures::LinkedList<T, ContentHash, Reclamation>::hash()
+{
+  if constexpr (ContentHash::maintained) {
+    if (!content_hash.current()) {
+      content_hash.reset();
+      for (Element* element = first; element != nullptr;
+           element = element->next)
+        content_hash.pushed_back(element->datum);
+    }
+    return content_hash.value();
+  } else {
+    return std::as_const(*this).hash();
+  }
+}
+
+template<typename T, typename ContentHash, typename Reclamation>
+void*
+DataStructures::LinkedList<T, ContentHash, Reclamation>::free_elements(
+  void* chain,
+  size_t budget)
+{
+  Element* current = static_cast<Element*>(chain);
+  while (current != nullptr && budget > 0) {
+    Element* next = current->next;
+    delete current;
+    current = next;
+    budget -= 1;
+  }
+  return current;
+}
+
+template<typename T, typename ContentHash, typename Reclamation>
+void
+DataStructures::LinkedList<T, ContentHash, Reclamation>::detach_front(
+  Element* rest,
+  size_t count)
+{
+  first = rest;
+  if (first == nullptr)
+    last = nullptr;
+  number_of_elements -= count;
+  if (finger != nullptr && finger_index < count)
+    finger = nullptr;
+  else if (finger != nullptr)
+    finger_index -= count;
+}
+
+template<typename T, typename ContentHash, typename Reclamation>
+size_t
+DataStructures::LinkedList<T, ContentHash, Reclamation>::segments_for(
+  size_t threads,
+  size_t length)
+{
+  // more threads than cores only adds the cost of splitting, which is
+  // more than twice the copy itself; 0 means the count is unknown
+  size_t cores = std::max(std::thread::hardware_concurrency(), 1u);
+  return std::min({ std::max(threads, size_t{ 1 }), cores, length });
+}
+
+template<typename T, typename ContentHash, typename Reclamation>
+template<typename InputIt>
+void
+DataStructures::LinkedList<T, ContentHash, Reclamation>::copy_segment(
+  InputIt source,
+  size_t count,
+  Element*& segment_first,
+  Element*& segment_last)
+{
+  assert(count > 0);
+  Element* head = new Element{ *source, nullptr };
+  Element* tail = head;
+  try {
+    for (size_t i = 1; i < count; ++i) {
+      ++source;
+      tail->next = new Element{ *source, nullptr };
+      tail = tail->next;
+    }
+  } catch (...) {
+    free_elements(head, SIZE_MAX);
+    throw;
+  }
+  segment_first = head;
+  segment_last = tail;
+}
+
+template<typename T, typename ContentHash, typename Reclamation>
+template<typename InputIt>
+void
+DataStructures::LinkedList<T, ContentHash, Reclamation>::build_segments(
+  const std::vector<InputIt>& starts,
+  const std::vector<size_t>& counts)
+{
+  size_t segments = starts.size();
+  if (segments == 0)
+    return;
+
+  std::vector<Element*> firsts(segments, nullptr);
+  std::vector<Element*> lasts(segments, nullptr);
+  std::vector<std::exception_ptr> failures(segments);
+  auto build_segment = [&](size_t segment) {
+    try {
+      copy_segment(
+        starts[segment], counts[segment], firsts[segment], lasts[segment]);
+    } catch (...) {
+      failures[segment] = std::current_exception();
+    }
+  };
+
+  // the calling thread builds the first segment itself, and any segment
+  // there is no thread to spare for
+  std::vector<std::thread> workers{};
+  workers.reserve(segments - 1);
+  for (size_t segment = 1; segment < segments; ++segment) {
+    try {
+      workers.emplace_back(build_segment, segment);
+    } catch (const std::system_error&) {
+      build_segment(segment);
+    }
+  }
+  build_segment(0);
+  for (std::thread& worker : workers)
+    worker.join();
+
+  for (std::exception_ptr failure : failures) {
+    if (failure == nullptr)
+      continue;
+    for (Element* segment_first : firsts)
+      free_elements(segment_first, SIZE_MAX);
+    std::rethrow_exception(failure);
+  }
+
+  for (size_t segment = 0; segment + 1 < segments; ++segment)
+    lasts[segment]->next = firsts[segment + 1];
+  first = firsts.front();
+  last = lasts.back();
+  for (size_t count : counts)
+    number_of_elements += count;
+}
+
+template<typename T, typename ContentHash, typename Reclamation>
+typename LinkedList<T, ContentHash, Reclamation>::Element*
+DataStructures::LinkedList<T, ContentHash, Reclamation>::walk_to(
+  size_t index) const
+{
+  assert(index < number_of_elements);
+  if (index == number_of_elements - 1)
+    return last;
+
+  // the list only links forward, so the finger is only of use when it
+  // isn't past the position wanted
+  Element* current_element = first;
+  size_t current_index = 0;
+  if (finger != nullptr && finger_index <= index) {
+    current_element = finger;
+    current_index = finger_index;
+  }
+  while (current_index < index) {
+    current_element = current_element->next;
+    current_index += 1;
+  }
+  return current_element;
+}
+
+template<typename T, typename ContentHash, typename Reclamation>
+typename LinkedList<T, ContentHash, Reclamation>::Element*
+DataStructures::LinkedList<T, ContentHash, Reclamation>::seek(size_t index)
+{
+  Element* found = walk_to(index);
+  finger = found;
+  finger_index = index;
+  return found;
+}
+
+template<typename T, typename ContentHash, typename Reclamation>
 bool
-operator==(const LinkedList<T>& a, const LinkedList<T>& b)
+operator==(const LinkedList<T, ContentHash, Reclamation>& a,
+           const LinkedList<T, ContentHash, Reclamation>& b)
 {
   return a.operator==(b);
 }
 
-template<typename T>
+template<typename T, typename ContentHash, typename Reclamation>
 bool
-operator!=(const LinkedList<T>& a, const LinkedList<T>& b)
+operator!=(const LinkedList<T, ContentHash, Reclamation>& a,
+           const LinkedList<T, ContentHash, Reclamation>& b)
 {
   return a.operator!=(b);
 }
 
-template<typename T>
+template<typename T, typename ContentHash, typename Reclamation>
 bool
-operator==(typename LinkedList<T>::iterator a,
-           typename LinkedList<T>::iterator b)
+operator==(typename LinkedList<T, ContentHash, Reclamation>::iterator a,
+           typename LinkedList<T, ContentHash, Reclamation>::iterator b)
 {
   return a.operator==(b);
 }
 
-template<typename T>
+template<typename T, typename ContentHash, typename Reclamation>
 bool
-operator!=(typename LinkedList<T>::iterator a,
-           typename LinkedList<T>::iterator b)
+operator!=(typename LinkedList<T, ContentHash, Reclamation>::iterator a,
+           typename LinkedList<T, ContentHash, Reclamation>::iterator b)
 {
   return a.operator!=(b);
 }
@@ -0,0 +1,119 @@
+#ifndef __DATA_STRUCTURES_NODE_RECLAMATION
+#define __DATA_STRUCTURES_NODE_RECLAMATION
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace DataStructures {
+
+/**
+  How a chain of nodes a container has let go of is freed: the first
+  `budget` nodes of the chain are freed and the rest of it is returned,
+  or null once the whole chain is gone.
+*/
+using FreeChain = void* (*)(void* chain, size_t budget);
+
+/**
+  The `LinkedList` reclamation policy that frees a cleared list's nodes
+  there and then.
+*/
+struct ImmediateReclamation
+{
+  static void dispose(void* chain, size_t count, FreeChain free_chain);
+};
+
+/**
+  The `LinkedList` reclamation policy that hands a cleared list's nodes
+  to a background thread to free, so that clearing or destroying even a
+  huge list takes O(1) on the calling thread.
+
+  The nodes' data are destroyed on that thread, so they mustn't care
+  which thread that is.  There is a bound on how many nodes may be
+  waiting to be freed; a list that would go over it is freed on the
+  calling thread instead, as it would have been without this policy.
+  There is one reclaimer thread for the whole process, started the
+  first time a list with this policy is made.
+*/
+class BackgroundReclamation
+{
+public:
+  /**
+    The number of nodes that may be waiting to be freed unless
+    set_limit() says otherwise.
+  */
+  static constexpr size_t default_limit = size_t{ 1 } << 26;
+
+  /**
+    Make sure the reclaimer is running, and will outlive whatever is
+    constructing this.
+  */
+  BackgroundReclamation();
+
+  /**
+    Hand a chain of nodes to the reclaimer.
+
+    @param  chain       The first node of the chain
+    @param  count       The number of nodes in the chain
+    @param  free_chain  How to free them
+  */
+  static void dispose(void* chain, size_t count, FreeChain free_chain);
+
+  /**
+    Wait until every node handed over so far has been freed.
+  */
+  static void flush();
+
+  /**
+    The number of nodes handed over but not yet freed.
+  */
+  static size_t outstanding();
+
+  /**
+    Change the bound on the number of nodes waiting to be freed.
+
+    @param  nodes   The new bound
+  */
+  static void set_limit(size_t nodes);
+
+private:
+  struct Garbage
+  {
+    void* chain;
+    size_t count;
+    FreeChain free_chain;
+  };
+
+  /**
+    The nodes the reclaimer thread frees between checks on whether
+    anyone is waiting for it.
+  */
+  static constexpr size_t batch_size = 4096;
+
+  struct Reclaimer
+  {
+    std::mutex mutex;
+    std::condition_variable work_arrived;
+    std::condition_variable work_done;
+    std::deque<Garbage> garbage;
+    size_t outstanding;
+    size_t limit;
+    bool stopping;
+    std::thread thread;
+
+    Reclaimer();
+    ~Reclaimer();
+    void run();
+  };
+
+  static Reclaimer& reclaimer();
+};
+
+#include "NodeReclamation.inl"
+
+} // namespace DataStructures
+
+#endif
@@ -0,0 +1,112 @@
+// inlined in NodeReclamation.h
+
+inline void
+DataStructures::ImmediateReclamation::dispose(void* chain,
+                                              size_t,
+                                              FreeChain free_chain)
+{
+  free_chain(chain, SIZE_MAX);
+}
+
+inline DataStructures::BackgroundReclamation::BackgroundReclamation()
+{
+  reclaimer();
+}
+
+inline void
+DataStructures::BackgroundReclamation::dispose(void* chain,
+                                               size_t count,
+                                               FreeChain free_chain)
+{
+  Reclaimer& the_reclaimer = reclaimer();
+  {
+    std::lock_guard<std::mutex> lock{ the_reclaimer.mutex };
+    if (the_reclaimer.outstanding + count <= the_reclaimer.limit) {
+      the_reclaimer.garbage.push_back(Garbage{ chain, count, free_chain });
+      the_reclaimer.outstanding += count;
+      the_reclaimer.work_arrived.notify_one();
+      return;
+    }
+  }
+  free_chain(chain, SIZE_MAX);
+}
+
+inline void
+DataStructures::BackgroundReclamation::flush()
+{
+  Reclaimer& the_reclaimer = reclaimer();
+  std::unique_lock<std::mutex> lock{ the_reclaimer.mutex };
+  the_reclaimer.work_done.wait(
+    lock, [&the_reclaimer]() { return the_reclaimer.outstanding == 0; });
+}
+
+inline size_t
+DataStructures::BackgroundReclamation::outstanding()
+{
+  Reclaimer& the_reclaimer = reclaimer();
+  std::lock_guard<std::mutex> lock{ the_reclaimer.mutex };
+  return the_reclaimer.outstanding;
+}
+
+inline void
+DataStructures::BackgroundReclamation::set_limit(size_t nodes)
+{
+  Reclaimer& the_reclaimer = reclaimer();
+  std::lock_guard<std::mutex> lock{ the_reclaimer.mutex };
+  the_reclaimer.limit = nodes;
+}
+
+inline DataStructures::BackgroundReclamation::Reclaimer::Reclaimer()
+  : outstanding(0)
+  , limit(default_limit)
+  , stopping(false)
+{
+  thread = std::thread{ [this]() { run(); } };
+}
+
+inline DataStructures::BackgroundReclamation::Reclaimer::~Reclaimer()
+{
+  {
+    std::lock_guard<std::mutex> lock{ mutex };
+    stopping = true;
+    work_arrived.notify_one();
+  }
+  // the thread frees whatever is left before it stops
+  thread.join();
+}
+
+inline void
+DataStructures::BackgroundReclamation::Reclaimer::run()
+{
+  std::unique_lock<std::mutex> lock{ mutex };
+  while (true) {
+    work_arrived.wait(lock, [this]() { return stopping || !garbage.empty(); });
+    if (garbage.empty())
+      return;
+
+    Garbage& next = garbage.front();
+    lock.unlock();
+    // freed a batch at a time, so that flush() and the limit see
+    // progress through a long chain
+    void* rest = next.free_chain(next.chain, batch_size);
+    size_t freed = batch_size;
+    lock.lock();
+    if (rest == nullptr) {
+      freed = next.count;
+      garbage.pop_front();
+    } else {
+      next.chain = rest;
+      next.count -= batch_size;
+    }
+    outstanding -= freed;
+    if (outstanding == 0)
+      work_done.notify_all();
+  }
+}
+
+inline DataStructures::BackgroundReclamation::Reclaimer&
+DataStructures::BackgroundReclamation::reclaimer()
+{
+  static Reclaimer the_reclaimer{};
+  return the_reclaimer;
+}
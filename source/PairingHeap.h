@@ -0,0 +1,184 @@
+#ifndef __DATA_STRUCTURES_PAIRING_HEAP
+#define __DATA_STRUCTURES_PAIRING_HEAP
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <utility>
+
+namespace DataStructures {
+
+/**
+  A priority queue kept as a tree of linked elements, each pointing to
+  its first child and its next sibling.
+
+  `push` and `meld` are O(1), `pop` is amortized O(log n) and
+  `decrease_key` is amortized o(log n).  Unlike `std::priority_queue`,
+  the top is the element that orders first under `Compare`, so the
+  default `std::less` gives the least element.
+*/
+template<typename T, typename Compare = std::less<T>>
+class PairingHeap
+{
+private:
+  struct Element
+  {
+    T datum;
+    Element* child;
+    Element* sibling;
+    // the parent of a first child, and the left sibling of any other
+    Element* previous;
+  };
+
+  Element* root;
+  size_t number_of_elements;
+  Compare less;
+
+public:
+  /**
+    A reference to an element of the heap that stays valid until that
+    element is popped or erased, even across melds.
+  */
+  class handle
+  {
+  private:
+    Element* element;
+    friend class PairingHeap;
+
+    explicit handle(Element* element)
+      : element(element)
+    {}
+
+  public:
+    explicit handle()
+      : element(nullptr)
+    {}
+    const T& operator*() const;
+  };
+
+  /**
+    Construct an empty heap.
+  */
+  PairingHeap();
+
+  /**
+    Construct the heap from the given contents.
+
+    @param  contents  Those elements which make up the heap.
+  */
+  PairingHeap(std::initializer_list<T> contents);
+
+  PairingHeap(const PairingHeap& other) = delete;
+  PairingHeap& operator=(const PairingHeap& other) = delete;
+
+  /**
+    Move the heap to a new place.  Handles follow the elements.
+  */
+  PairingHeap(PairingHeap&& other) noexcept;
+
+  /**
+    Move data from another heap to this heap.  Handles follow the
+    elements.
+  */
+  PairingHeap& operator=(PairingHeap&& other) noexcept;
+
+  /**
+    Destroy the heap.
+  */
+  ~PairingHeap();
+
+  /**
+    The number of elements in the heap.
+  */
+  size_t size() const;
+
+  /**
+    Check if there are exactly 0 elements in the heap.
+  */
+  bool empty() const;
+
+  /**
+    The value that orders first in the heap.
+
+    Should the heap be empty, this method will result in undefined
+    behaviour, likely a crash.
+  */
+  const T& top() const;
+
+  /**
+    Add the given value to the heap.
+
+    @param  new_value   The datum to be added to the heap
+
+    @return A handle to the new element
+  */
+  handle push(const T& new_value);
+
+  /**
+    Remove the value that orders first from the heap and return it.
+
+    Should the heap be empty, this method will result in undefined
+    behaviour, likely a crash.
+
+    @return The datum formerly at the top of the heap
+  */
+  T pop();
+
+  /**
+    Move every element of the other heap into this one, leaving the
+    other empty.
+
+    @param  other   The heap to take the elements of
+  */
+  void meld(PairingHeap& other);
+
+  /**
+    Change the value of an element to one that orders no later.
+
+    Should the new value order after the old one, or the handle not be
+    to an element of this heap, this method will result in undefined
+    behaviour.
+
+    @param  element     A handle to the element to change
+    @param  new_value   The element's new datum
+  */
+  void decrease_key(handle element, const T& new_value);
+
+  /**
+    Remove the element from the heap, wherever it is.
+
+    @param  element     A handle to the element to remove
+
+    @return The datum of the element
+  */
+  T erase(handle element);
+
+  /**
+    Remove all elements from the heap.
+  */
+  void clear();
+
+private:
+  /**
+    Make the root that orders later the first child of the other.
+  */
+  Element* link(Element* a, Element* b);
+
+  /**
+    Detach an element and its subtree from its parent.
+  */
+  static void cut(Element* element);
+
+  /**
+    Join a list of siblings into one tree, pairing them left to right
+    and then folding the pairs right to left.
+  */
+  Element* merge_pairs(Element* first);
+};
+
+#include "PairingHeap.inl"
+
+} // namespace DataStructures
+
+#endif
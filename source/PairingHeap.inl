@@ -0,0 +1,226 @@
+// inlined in PairingHeap.h
+
+template<typename T, typename Compare>
+const T&
+DataStructures::PairingHeap<T, Compare>::handle::operator*() const
+{
+  return element->datum;
+}
+
+template<typename T, typename Compare>
+DataStructures::PairingHeap<T, Compare>::PairingHeap()
+{
+  root = nullptr;
+  number_of_elements = 0;
+}
+
+template<typename T, typename Compare>
+DataStructures::PairingHeap<T, Compare>::PairingHeap(
+  std::initializer_list<T> contents)
+  : PairingHeap()
+{
+  for (const T& datum : contents)
+    push(datum);
+}
+
+template<typename T, typename Compare>
+DataStructures::PairingHeap<T, Compare>::PairingHeap(
+  PairingHeap&& other) noexcept
+  : PairingHeap()
+{
+  *this = std::move(other);
+}
+
+template<typename T, typename Compare>
+PairingHeap<T, Compare>&
+DataStructures::PairingHeap<T, Compare>::operator=(
+  PairingHeap&& other) noexcept
+{
+  if (this == &other)
+    return *this;
+  std::swap(root, other.root);
+  std::swap(number_of_elements, other.number_of_elements);
+  std::swap(less, other.less);
+  return *this;
+}
+
+template<typename T, typename Compare>
+DataStructures::PairingHeap<T, Compare>::~PairingHeap()
+{
+  clear();
+}
+
+template<typename T, typename Compare>
+size_t
+DataStructures::PairingHeap<T, Compare>::size() const
+{
+  return number_of_elements;
+}
+
+template<typename T, typename Compare>
+bool
+DataStructures::PairingHeap<T, Compare>::empty() const
+{
+  return number_of_elements == 0;
+}
+
+template<typename T, typename Compare>
+const T&
+DataStructures::PairingHeap<T, Compare>::top() const
+{
+  assert(!empty());
+  return root->datum;
+}
+
+template<typename T, typename Compare>
+typename PairingHeap<T, Compare>::handle
+DataStructures::PairingHeap<T, Compare>::push(const T& new_value)
+{
+  Element* new_element = new Element{ new_value, nullptr, nullptr, nullptr };
+  root = root == nullptr ? new_element : link(root, new_element);
+  number_of_elements += 1;
+  return handle{ new_element };
+}
+
+template<typename T, typename Compare>
+T
+DataStructures::PairingHeap<T, Compare>::pop()
+{
+  assert(!empty());
+  Element* old_root = root;
+  root = merge_pairs(old_root->child);
+  number_of_elements -= 1;
+  T old_root_datum = std::move(old_root->datum);
+  delete old_root;
+  return old_root_datum;
+}
+
+template<typename T, typename Compare>
+void
+DataStructures::PairingHeap<T, Compare>::meld(PairingHeap& other)
+{
+  if (this == &other || other.empty())
+    return;
+  root = root == nullptr ? other.root : link(root, other.root);
+  number_of_elements += other.number_of_elements;
+  other.root = nullptr;
+  other.number_of_elements = 0;
+}
+
+template<typename T, typename Compare>
+void
+DataStructures::PairingHeap<T, Compare>::decrease_key(handle element,
+                                                      const T& new_value)
+{
+  Element* changed = element.element;
+  assert(changed != nullptr && !less(changed->datum, new_value));
+  changed->datum = new_value;
+  if (changed == root)
+    return;
+  // the subtree is still ordered under the element, so only the link to
+  // its parent can be wrong
+  cut(changed);
+  root = link(root, changed);
+}
+
+template<typename T, typename Compare>
+T
+DataStructures::PairingHeap<T, Compare>::erase(handle element)
+{
+  Element* erased = element.element;
+  assert(erased != nullptr);
+  if (erased == root)
+    return pop();
+  cut(erased);
+  Element* orphans = merge_pairs(erased->child);
+  if (orphans != nullptr)
+    root = link(root, orphans);
+  number_of_elements -= 1;
+  T erased_datum = std::move(erased->datum);
+  delete erased;
+  return erased_datum;
+}
+
+template<typename T, typename Compare>
+void
+DataStructures::PairingHeap<T, Compare>::clear()
+{
+  // splice each element's children in after it, so the whole tree is
+  // freed as one list without recursion
+  Element* current = root;
+  while (current != nullptr) {
+    if (current->child != nullptr) {
+      Element* last_child = current->child;
+      while (last_child->sibling != nullptr)
+        last_child = last_child->sibling;
+      last_child->sibling = current->sibling;
+      current->sibling = current->child;
+    }
+    Element* next = current->sibling;
+    delete current;
+    current = next;
+  }
+  root = nullptr;
+  number_of_elements = 0;
+}
+
+template<typename T, typename Compare>
+typename PairingHeap<T, Compare>::Element*
+DataStructures::PairingHeap<T, Compare>::link(Element* a, Element* b)
+{
+  if (less(b->datum, a->datum))
+    std::swap(a, b);
+  b->previous = a;
+  b->sibling = a->child;
+  if (a->child != nullptr)
+    a->child->previous = b;
+  a->child = b;
+  a->previous = nullptr;
+  a->sibling = nullptr;
+  return a;
+}
+
+template<typename T, typename Compare>
+void
+DataStructures::PairingHeap<T, Compare>::cut(Element* element)
+{
+  if (element->previous->child == element)
+    element->previous->child = element->sibling;
+  else
+    element->previous->sibling = element->sibling;
+  if (element->sibling != nullptr)
+    element->sibling->previous = element->previous;
+  element->previous = nullptr;
+  element->sibling = nullptr;
+}
+
+template<typename T, typename Compare>
+typename PairingHeap<T, Compare>::Element*
+DataStructures::PairingHeap<T, Compare>::merge_pairs(Element* first)
+{
+  if (first == nullptr)
+    return nullptr;
+
+  // the pairs are stacked through their sibling links, so the fold
+  // below naturally goes right to left
+  Element* pairs = nullptr;
+  while (first != nullptr) {
+    Element* a = first;
+    Element* b = a->sibling;
+    first = b == nullptr ? nullptr : b->sibling;
+    Element* pair = b == nullptr ? a : link(a, b);
+    pair->previous = nullptr;
+    pair->sibling = pairs;
+    pairs = pair;
+  }
+
+  Element* merged = pairs;
+  pairs = pairs->sibling;
+  merged->sibling = nullptr;
+  while (pairs != nullptr) {
+    Element* next = pairs->sibling;
+    merged = link(merged, pairs);
+    pairs = next;
+  }
+  return merged;
+}
@@ -0,0 +1,234 @@
+#ifndef __DATA_STRUCTURES_RADIX_TRIE
+#define __DATA_STRUCTURES_RADIX_TRIE
+
+#include "LinkedList.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace DataStructures {
+
+/**
+  A set of strings that iterates in the order they were inserted, like a
+  `LinkedList<std::string>`, but is indexed by a radix trie, so that
+  `contains`, `remove` and finding the strings with a given prefix take
+  time proportional to the length of the key rather than to the number
+  of strings.
+
+  The trie is path compressed: each node's edge is labelled with as long
+  a run of characters as no other string branches off of, so there are
+  fewer than two nodes per string.  A node's children are kept in a
+  chain sorted by their first character, so each step down looks
+  through at most 256 of them.  The nodes live in one arena and are
+  referred to by index, so they cost no allocation apiece and the trie
+  can be copied wholesale.  The root is made by the first insertion, so
+  an empty trie, or one moved from, holds no nodes at all.
+*/
+class RadixTrie
+{
+private:
+  static constexpr uint32_t no_node = UINT32_MAX;
+  // the first node made, once there are any
+  static constexpr uint32_t root = 0;
+
+  struct Node
+  {
+    // the characters on the edge from the parent to this node
+    std::string label;
+    // the whole string, if one ends at this node
+    std::string key;
+    uint32_t parent;
+    uint32_t first_child;
+    // the next child of the parent, and the next free node while this
+    // one is free
+    uint32_t next_sibling;
+    // the strings before and after this one in insertion order
+    uint32_t previous_key;
+    uint32_t next_key;
+    bool terminal;
+  };
+
+  std::vector<Node> nodes;
+  uint32_t free_nodes;
+  uint32_t first_key;
+  uint32_t last_key;
+  size_t number_of_keys;
+
+public:
+  /**
+    A type for iterating forward through the strings in the order they
+    were inserted.
+
+    Iterators stay valid through any change except removing the string
+    they refer to.
+  */
+  class iterator
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::string;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const std::string*;
+    using reference = const std::string&;
+
+  private:
+    const RadixTrie* trie;
+    uint32_t current;
+
+  public:
+    explicit iterator(const RadixTrie* trie, uint32_t start);
+    explicit iterator()
+      : trie(nullptr)
+      , current(no_node)
+    {}
+    iterator& operator++();
+    bool operator==(iterator other) const;
+    bool operator!=(iterator other) const;
+    const std::string& operator*() const;
+  };
+
+  /**
+    An iterator to the first string inserted.
+  */
+  iterator begin() const;
+
+  /**
+    An iterator to the terminus of the trie.
+  */
+  iterator end() const;
+
+  /**
+    Construct an empty trie.
+  */
+  RadixTrie();
+
+  /**
+    Construct the trie from the given strings, dropping duplicates.
+
+    @param  contents  Those strings which make up the trie.
+  */
+  RadixTrie(std::initializer_list<std::string> contents);
+
+  /**
+    Construct the trie from the strings of a list, in the list's order,
+    dropping duplicates.
+
+    @param  strings   The list to index
+  */
+  explicit RadixTrie(const LinkedList<std::string>& strings);
+
+  /**
+    Construct a copy of a trie.
+  */
+  RadixTrie(const RadixTrie& other) = default;
+
+  /**
+    Move the trie to a new place, leaving the old one empty.
+  */
+  RadixTrie(RadixTrie&& other) noexcept;
+
+  /**
+    Assign the trie a copy of another trie.
+  */
+  RadixTrie& operator=(const RadixTrie& other) = default;
+
+  /**
+    Move the strings of another trie to this one, leaving it empty.
+  */
+  RadixTrie& operator=(RadixTrie&& other) noexcept;
+
+  /**
+    The number of strings in the trie.
+  */
+  size_t size() const;
+
+  /**
+    Check if there are exactly 0 strings in the trie.
+  */
+  bool empty() const;
+
+  /**
+    Add a string after all the others, unless it is already there.
+
+    @param  key   The string to be added
+
+    @return True if key was added, otherwise false
+  */
+  bool insert(const std::string& key);
+
+  /**
+    Check if the trie has the given string.
+
+    @param  key   The string to look for
+  */
+  bool contains(std::string_view key) const;
+
+  /**
+    Delete the given string.
+
+    @param  key   That string which will be tossed out.
+
+    @return True if key was there to be removed, otherwise false
+  */
+  bool remove(std::string_view key);
+
+  /**
+    Call the closure on every string that starts with the prefix, in
+    lexicographic order of their bytes.
+
+    @param  prefix    What the strings must start with
+    @param  closure   What to do with each string
+  */
+  template<typename Closure>
+  void for_each_with_prefix(std::string_view prefix, Closure closure) const;
+
+  /**
+    Remove all strings from the trie.
+  */
+  void clear();
+
+private:
+  uint32_t allocate(std::string_view label, uint32_t parent);
+  void release(uint32_t index);
+
+  /**
+    The child of the node whose label starts with the character, if any.
+  */
+  uint32_t child_starting_with(uint32_t parent, char first) const;
+
+  /**
+    The node the key ends at, whether or not a string ends there, or
+    no_node if there is none.
+  */
+  uint32_t find_node(std::string_view key) const;
+
+  /**
+    Link the child in among its siblings, in order.
+  */
+  void adopt(uint32_t parent, uint32_t child);
+
+  /**
+    Put one child of the node in the place of another.
+  */
+  void replace_child(uint32_t parent, uint32_t old_child, uint32_t new_child);
+
+  void unlink_child(uint32_t parent, uint32_t child);
+
+  /**
+    Restore path compression after the node stopped being the end of a
+    string, by freeing it if it has no children left or merging it into
+    its child if it has one.
+  */
+  void compact(uint32_t index);
+};
+
+#include "RadixTrie.inl"
+
+} // namespace DataStructures
+
+#endif
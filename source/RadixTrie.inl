@@ -0,0 +1,366 @@
+// inlined in RadixTrie.h
+
+inline DataStructures::RadixTrie::iterator::iterator(const RadixTrie* trie,
+                                                     uint32_t start)
+  : trie(trie)
+  , current(start)
+{}
+
+inline DataStructures::RadixTrie::iterator&
+DataStructures::RadixTrie::iterator::operator++()
+{
+  current = trie->nodes[current].next_key;
+  return *this;
+}
+
+inline bool
+DataStructures::RadixTrie::iterator::operator==(iterator other) const
+{
+  return current == other.current;
+}
+
+inline bool
+DataStructures::RadixTrie::iterator::operator!=(iterator other) const
+{
+  return !operator==(other);
+}
+
+inline const std::string&
+DataStructures::RadixTrie::iterator::operator*() const
+{
+  return trie->nodes[current].key;
+}
+
+inline DataStructures::RadixTrie::iterator
+DataStructures::RadixTrie::begin() const
+{
+  return iterator{ this, first_key };
+}
+
+inline DataStructures::RadixTrie::iterator
+DataStructures::RadixTrie::end() const
+{
+  return iterator{ this, no_node };
+}
+
+inline DataStructures::RadixTrie::RadixTrie()
+  : nodes()
+  , free_nodes(no_node)
+  , first_key(no_node)
+  , last_key(no_node)
+  , number_of_keys(0)
+{}
+
+inline DataStructures::RadixTrie::RadixTrie(
+  std::initializer_list<std::string> contents)
+  : RadixTrie()
+{
+  for (const std::string& key : contents)
+    insert(key);
+}
+
+inline DataStructures::RadixTrie::RadixTrie(
+  const LinkedList<std::string>& strings)
+  : RadixTrie()
+{
+  for (const std::string& key : strings)
+    insert(key);
+}
+
+inline DataStructures::RadixTrie::RadixTrie(RadixTrie&& other) noexcept
+  : nodes(std::move(other.nodes))
+  , free_nodes(other.free_nodes)
+  , first_key(other.first_key)
+  , last_key(other.last_key)
+  , number_of_keys(other.number_of_keys)
+{
+  other.clear();
+}
+
+inline DataStructures::RadixTrie&
+DataStructures::RadixTrie::operator=(RadixTrie&& other) noexcept
+{
+  if (this == &other)
+    return *this;
+  nodes = std::move(other.nodes);
+  free_nodes = other.free_nodes;
+  first_key = other.first_key;
+  last_key = other.last_key;
+  number_of_keys = other.number_of_keys;
+  other.clear();
+  return *this;
+}
+
+inline size_t
+DataStructures::RadixTrie::size() const
+{
+  return number_of_keys;
+}
+
+inline bool
+DataStructures::RadixTrie::empty() const
+{
+  return number_of_keys == 0;
+}
+
+inline bool
+DataStructures::RadixTrie::insert(const std::string& key)
+{
+  if (nodes.empty())
+    allocate("", no_node);
+  uint32_t node = root;
+  std::string_view rest = key;
+  while (!rest.empty()) {
+    uint32_t child = child_starting_with(node, rest.front());
+    if (child == no_node) {
+      uint32_t leaf = allocate(rest, node);
+      adopt(node, leaf);
+      node = leaf;
+      break;
+    }
+
+    std::string_view label = nodes[child].label;
+    size_t common = 1;
+    while (common < label.size() && common < rest.size() &&
+           label[common] == rest[common])
+      common += 1;
+    if (common < label.size()) {
+      // the key branches off partway along the edge, so it is split
+      // with a node where they part
+      uint32_t middle = allocate(rest.substr(0, common), node);
+      replace_child(node, child, middle);
+      nodes[child].label.erase(0, common);
+      nodes[child].parent = middle;
+      nodes[child].next_sibling = no_node;
+      nodes[middle].first_child = child;
+      child = middle;
+    }
+    node = child;
+    rest.remove_prefix(common);
+  }
+
+  Node& end = nodes[node];
+  if (end.terminal)
+    return false;
+  end.terminal = true;
+  end.key = key;
+  end.previous_key = last_key;
+  end.next_key = no_node;
+  if (last_key == no_node)
+    first_key = node;
+  else
+    nodes[last_key].next_key = node;
+  last_key = node;
+  number_of_keys += 1;
+  return true;
+}
+
+inline bool
+DataStructures::RadixTrie::contains(std::string_view key) const
+{
+  uint32_t node = find_node(key);
+  return node != no_node && nodes[node].terminal;
+}
+
+inline bool
+DataStructures::RadixTrie::remove(std::string_view key)
+{
+  uint32_t node = find_node(key);
+  if (node == no_node || !nodes[node].terminal)
+    return false;
+
+  Node& end = nodes[node];
+  if (end.previous_key == no_node)
+    first_key = end.next_key;
+  else
+    nodes[end.previous_key].next_key = end.next_key;
+  if (end.next_key == no_node)
+    last_key = end.previous_key;
+  else
+    nodes[end.next_key].previous_key = end.previous_key;
+  end.terminal = false;
+  end.key = std::string{};
+  number_of_keys -= 1;
+
+  compact(node);
+  return true;
+}
+
+template<typename Closure>
+void
+DataStructures::RadixTrie::for_each_with_prefix(std::string_view prefix,
+                                                Closure closure) const
+{
+  if (nodes.empty())
+    return;
+
+  // find the highest node all of whose strings have the prefix
+  uint32_t top = root;
+  std::string_view rest = prefix;
+  while (!rest.empty()) {
+    top = child_starting_with(top, rest.front());
+    if (top == no_node)
+      return;
+    std::string_view label = nodes[top].label;
+    if (rest.size() <= label.size()) {
+      if (label.substr(0, rest.size()) != rest)
+        return;
+      break;
+    }
+    if (rest.substr(0, label.size()) != label)
+      return;
+    rest.remove_prefix(label.size());
+  }
+
+  // a preorder walk of its subtree, which needs no stack since every
+  // node knows its parent
+  uint32_t node = top;
+  while (true) {
+    if (nodes[node].terminal)
+      closure(nodes[node].key);
+    if (nodes[node].first_child != no_node) {
+      node = nodes[node].first_child;
+      continue;
+    }
+    while (node != top && nodes[node].next_sibling == no_node)
+      node = nodes[node].parent;
+    if (node == top)
+      return;
+    node = nodes[node].next_sibling;
+  }
+}
+
+inline void
+DataStructures::RadixTrie::clear()
+{
+  nodes.clear();
+  free_nodes = no_node;
+  first_key = no_node;
+  last_key = no_node;
+  number_of_keys = 0;
+}
+
+inline uint32_t
+DataStructures::RadixTrie::allocate(std::string_view label, uint32_t parent)
+{
+  uint32_t index = free_nodes;
+  if (index == no_node) {
+    index = static_cast<uint32_t>(nodes.size());
+    nodes.push_back(Node{});
+  } else {
+    free_nodes = nodes[index].next_sibling;
+  }
+
+  Node& node = nodes[index];
+  node.label = label;
+  node.parent = parent;
+  node.first_child = no_node;
+  node.next_sibling = no_node;
+  node.previous_key = no_node;
+  node.next_key = no_node;
+  node.terminal = false;
+  return index;
+}
+
+inline void
+DataStructures::RadixTrie::release(uint32_t index)
+{
+  Node& node = nodes[index];
+  node.label = std::string{};
+  node.next_sibling = free_nodes;
+  free_nodes = index;
+}
+
+inline uint32_t
+DataStructures::RadixTrie::child_starting_with(uint32_t parent,
+                                               char first) const
+{
+  uint32_t child = nodes[parent].first_child;
+  while (child != no_node) {
+    unsigned char found = nodes[child].label.front();
+    if (found == static_cast<unsigned char>(first))
+      return child;
+    // the siblings are in order, so it would have been passed
+    if (found > static_cast<unsigned char>(first))
+      return no_node;
+    child = nodes[child].next_sibling;
+  }
+  return no_node;
+}
+
+inline uint32_t
+DataStructures::RadixTrie::find_node(std::string_view key) const
+{
+  if (nodes.empty())
+    return no_node;
+  uint32_t node = root;
+  while (!key.empty()) {
+    node = child_starting_with(node, key.front());
+    if (node == no_node)
+      return no_node;
+    std::string_view label = nodes[node].label;
+    if (key.substr(0, label.size()) != label)
+      return no_node;
+    key.remove_prefix(label.size());
+  }
+  return node;
+}
+
+inline void
+DataStructures::RadixTrie::adopt(uint32_t parent, uint32_t child)
+{
+  unsigned char first = nodes[child].label.front();
+  uint32_t* link = &nodes[parent].first_child;
+  while (*link != no_node &&
+         static_cast<unsigned char>(nodes[*link].label.front()) < first)
+    link = &nodes[*link].next_sibling;
+  nodes[child].next_sibling = *link;
+  *link = child;
+}
+
+inline void
+DataStructures::RadixTrie::replace_child(uint32_t parent,
+                                         uint32_t old_child,
+                                         uint32_t new_child)
+{
+  uint32_t* link = &nodes[parent].first_child;
+  while (*link != old_child)
+    link = &nodes[*link].next_sibling;
+  nodes[new_child].next_sibling = nodes[old_child].next_sibling;
+  *link = new_child;
+}
+
+inline void
+DataStructures::RadixTrie::unlink_child(uint32_t parent, uint32_t child)
+{
+  uint32_t* link = &nodes[parent].first_child;
+  while (*link != child)
+    link = &nodes[*link].next_sibling;
+  *link = nodes[child].next_sibling;
+}
+
+inline void
+DataStructures::RadixTrie::compact(uint32_t index)
+{
+  // every node but the root either ends a string or has at least two
+  // children, so at most this node and its parent need fixing
+  while (index != root && !nodes[index].terminal) {
+    uint32_t parent = nodes[index].parent;
+    uint32_t child = nodes[index].first_child;
+    if (child == no_node) {
+      unlink_child(parent, index);
+      release(index);
+      index = parent;
+      continue;
+    }
+    if (nodes[child].next_sibling != no_node)
+      return;
+
+    // the child keeps its index, as the insertion order refers to it
+    nodes[child].label.insert(0, nodes[index].label);
+    nodes[child].parent = parent;
+    replace_child(parent, index, child);
+    release(index);
+    return;
+  }
+}
@@ -0,0 +1,165 @@
+#ifndef __DATA_STRUCTURES_RCU_LIST
+#define __DATA_STRUCTURES_RCU_LIST
+
+#include "EpochReclamation.h"
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <mutex>
+
+namespace DataStructures {
+
+/**
+  A singly linked list for data that is read far more often than it is
+  written, in the style of read-copy-update.
+
+  Readers take no lock and make no atomic read-modify-write; they follow
+  the links inside an `EpochReclamation::Guard`.  Writers take turns on a
+  mutex and never change an element readers may be looking at.  Instead
+  they link in a new element, or a changed copy of one, with a single
+  pointer store, and retire whatever was unlinked so that it is freed
+  once no reader can still be on it.
+
+  A reader sees every element that was in the list for the whole of its
+  walk, and for any other element either the old or the new version.
+  The read methods take their closures as template parameters so that
+  a lookup costs no more than walking the list.
+*/
+template<typename T>
+class RcuList
+{
+private:
+  struct Element
+  {
+    const T datum;
+    std::atomic<Element*> next;
+  };
+
+  std::atomic<Element*> first;
+  // only used by writers, under writer_mutex
+  Element* last;
+  std::atomic<size_t> number_of_elements;
+  std::mutex writer_mutex;
+
+public:
+  /**
+    Construct the list from the logical contents.
+
+    @param  contents  Those elements which make up the list.
+  */
+  RcuList(std::initializer_list<T> contents);
+
+  /**
+    Construct an empty list.
+  */
+  RcuList();
+
+  RcuList(const RcuList& other) = delete;
+  RcuList& operator=(const RcuList& other) = delete;
+
+  /**
+    Destroy the list.  No other thread may be using it.
+  */
+  ~RcuList();
+
+  /**
+    The number of elements in the list.
+  */
+  size_t size() const;
+
+  /**
+    Check if there are exactly 0 elements in the list.
+  */
+  bool empty() const;
+
+  /**
+    Call the closure on every element of the list, in order.
+
+    @param  closure   What to do with each element
+  */
+  template<typename Closure>
+  void for_each(Closure closure) const;
+
+  /**
+    Check if the list has an element equal to the given value.
+
+    @param  value   The value to look for
+  */
+  bool contains(const T& value) const;
+
+  /**
+    Copy out the first element that satisfies the predicate.
+
+    @param  predicate   What the element must satisfy
+    @param  found       Where to copy the element, if there is one
+
+    @return True if an element satisfied the predicate, otherwise false
+  */
+  template<typename Predicate>
+  bool find(Predicate predicate, T& found) const;
+
+  /**
+    Add the given value to the beginning of the list.
+
+    @param  new_value   The datum to be added to the list
+  */
+  void push_front(const T& new_value);
+
+  /**
+    Add the given value to the end of the list.
+
+    @param  new_value   The datum to be added to the list
+  */
+  void push_back(const T& new_value);
+
+  /**
+    Delete the first element equal to the given value.
+
+    @param  value   That value whose equal will be tossed out.
+
+    @return True if value had an equal to be removed, otherwise false
+  */
+  bool remove(const T& value);
+
+  /**
+    Swap the first element equal to the given value for a new one.
+
+    Readers see either the old element or the new one, never neither.
+
+    @param  old_value   That value whose equal will be replaced
+    @param  new_value   The datum to put in its place
+
+    @return True if old_value had an equal to be replaced, otherwise false
+  */
+  bool replace(const T& old_value, const T& new_value);
+
+  /**
+    Apply the given function element-wise to the list.
+
+    The changed list is built aside and swapped in all at once, so readers
+    see the list either wholly before or wholly after.
+
+    @param closure  A function representing the desired mutation
+  */
+  void map(std::function<T(const T&)> closure);
+
+  /**
+    Remove all elements from the list.
+  */
+  void clear();
+
+private:
+  /**
+    Hand a chain of elements, no longer reachable, to be freed as soon
+    as no reader can be on it.
+  */
+  static void retire_chain(Element* chain);
+};
+
+#include "RcuList.inl"
+
+} // namespace DataStructures
+
+#endif
@@ -0,0 +1,215 @@
+// inlined in RcuList.h
+
+template<typename T>
+DataStructures::RcuList<T>::RcuList(std::initializer_list<T> contents)
+  : RcuList()
+{
+  for (const T& datum : contents)
+    push_back(datum);
+}
+
+template<typename T>
+DataStructures::RcuList<T>::RcuList()
+  : first(nullptr)
+  , last(nullptr)
+  , number_of_elements(0)
+{}
+
+template<typename T>
+DataStructures::RcuList<T>::~RcuList()
+{
+  Element* element = first.load(std::memory_order_relaxed);
+  while (element != nullptr) {
+    Element* next = element->next.load(std::memory_order_relaxed);
+    delete element;
+    element = next;
+  }
+}
+
+template<typename T>
+size_t
+DataStructures::RcuList<T>::size() const
+{
+  return number_of_elements.load(std::memory_order_relaxed);
+}
+
+template<typename T>
+bool
+DataStructures::RcuList<T>::empty() const
+{
+  return size() == 0;
+}
+
+template<typename T>
+template<typename Closure>
+void
+DataStructures::RcuList<T>::for_each(Closure closure) const
+{
+  EpochReclamation::Guard guard{};
+  for (Element* element = first.load(std::memory_order_acquire);
+       element != nullptr;
+       element = element->next.load(std::memory_order_acquire))
+    closure(element->datum);
+}
+
+template<typename T>
+bool
+DataStructures::RcuList<T>::contains(const T& value) const
+{
+  EpochReclamation::Guard guard{};
+  for (Element* element = first.load(std::memory_order_acquire);
+       element != nullptr;
+       element = element->next.load(std::memory_order_acquire))
+    if (element->datum == value)
+      return true;
+  return false;
+}
+
+template<typename T>
+template<typename Predicate>
+bool
+DataStructures::RcuList<T>::find(Predicate predicate, T& found) const
+{
+  EpochReclamation::Guard guard{};
+  for (Element* element = first.load(std::memory_order_acquire);
+       element != nullptr;
+       element = element->next.load(std::memory_order_acquire)) {
+    if (predicate(element->datum)) {
+      found = element->datum;
+      return true;
+    }
+  }
+  return false;
+}
+
+template<typename T>
+void
+DataStructures::RcuList<T>::push_front(const T& new_value)
+{
+  std::lock_guard<std::mutex> lock{ writer_mutex };
+  Element* old_first = first.load(std::memory_order_relaxed);
+  Element* new_first = new Element{ new_value, { old_first } };
+  if (old_first == nullptr)
+    last = new_first;
+  first.store(new_first, std::memory_order_release);
+  number_of_elements.store(size() + 1, std::memory_order_relaxed);
+}
+
+template<typename T>
+void
+DataStructures::RcuList<T>::push_back(const T& new_value)
+{
+  std::lock_guard<std::mutex> lock{ writer_mutex };
+  Element* new_last = new Element{ new_value, { nullptr } };
+  if (last == nullptr)
+    first.store(new_last, std::memory_order_release);
+  else
+    last->next.store(new_last, std::memory_order_release);
+  last = new_last;
+  number_of_elements.store(size() + 1, std::memory_order_relaxed);
+}
+
+template<typename T>
+bool
+DataStructures::RcuList<T>::remove(const T& value)
+{
+  std::lock_guard<std::mutex> lock{ writer_mutex };
+  std::atomic<Element*>* link = &first;
+  Element* previous_element = nullptr;
+  Element* current_element = link->load(std::memory_order_relaxed);
+  while (current_element != nullptr) {
+    if (current_element->datum == value) {
+      // the removed element keeps its link, so a reader standing on it
+      // can still carry on to the rest of the list
+      link->store(current_element->next.load(std::memory_order_relaxed),
+                  std::memory_order_release);
+      if (current_element == last)
+        last = previous_element;
+      number_of_elements.store(size() - 1, std::memory_order_relaxed);
+      EpochReclamation::retire(current_element);
+      return true;
+    }
+    previous_element = current_element;
+    link = &current_element->next;
+    current_element = link->load(std::memory_order_relaxed);
+  }
+  return false;
+}
+
+template<typename T>
+bool
+DataStructures::RcuList<T>::replace(const T& old_value, const T& new_value)
+{
+  std::lock_guard<std::mutex> lock{ writer_mutex };
+  std::atomic<Element*>* link = &first;
+  Element* current_element = link->load(std::memory_order_relaxed);
+  while (current_element != nullptr) {
+    if (current_element->datum == old_value) {
+      Element* new_element = new Element{
+        new_value, { current_element->next.load(std::memory_order_relaxed) }
+      };
+      link->store(new_element, std::memory_order_release);
+      if (current_element == last)
+        last = new_element;
+      EpochReclamation::retire(current_element);
+      return true;
+    }
+    link = &current_element->next;
+    current_element = link->load(std::memory_order_relaxed);
+  }
+  return false;
+}
+
+template<typename T>
+void
+DataStructures::RcuList<T>::map(std::function<T(const T&)> closure)
+{
+  std::lock_guard<std::mutex> lock{ writer_mutex };
+  Element* old_first = first.load(std::memory_order_relaxed);
+  Element* new_first = nullptr;
+  Element* new_last = nullptr;
+  for (Element* element = old_first; element != nullptr;
+       element = element->next.load(std::memory_order_relaxed)) {
+    Element* copy = new Element{ closure(element->datum), { nullptr } };
+    if (new_last == nullptr)
+      new_first = copy;
+    else
+      new_last->next.store(copy, std::memory_order_relaxed);
+    new_last = copy;
+  }
+  // the release publishes the whole new chain at once
+  first.store(new_first, std::memory_order_release);
+  last = new_last;
+  retire_chain(old_first);
+}
+
+template<typename T>
+void
+DataStructures::RcuList<T>::clear()
+{
+  std::lock_guard<std::mutex> lock{ writer_mutex };
+  Element* old_first = first.load(std::memory_order_relaxed);
+  first.store(nullptr, std::memory_order_release);
+  last = nullptr;
+  number_of_elements.store(0, std::memory_order_relaxed);
+  retire_chain(old_first);
+}
+
+template<typename T>
+void
+DataStructures::RcuList<T>::retire_chain(Element* chain)
+{
+  if (chain == nullptr)
+    return;
+  // the chain is retired as one piece, freed by walking it
+  EpochReclamation::retire(chain, [](void* pointer) {
+    Element* element = static_cast<Element*>(pointer);
+    while (element != nullptr) {
+      Element* next = element->next.load(std::memory_order_relaxed);
+      delete element;
+      element = next;
+    }
+  });
+  // it may be the whole list, too much to wait for a batch to fill
+  EpochReclamation::reclaim();
+}
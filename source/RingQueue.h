@@ -0,0 +1,165 @@
+#ifndef __DATA_STRUCTURES_RING_QUEUE
+#define __DATA_STRUCTURES_RING_QUEUE
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <new>
+#include <utility>
+
+namespace DataStructures {
+
+/**
+  A first-in first-out queue kept in one power-of-two sized buffer.
+
+  Pushing and popping only move an index, so there is no allocation per
+  element, unlike a `LinkedList` used as a queue.  What happens when the
+  buffer is full is chosen when the queue is made.
+*/
+template<typename T>
+class RingQueue
+{
+public:
+  /**
+    What push_back does when every slot is taken.
+  */
+  enum class FullPolicy
+  {
+    grow,      ///< double the capacity and keep everything
+    overwrite, ///< drop the oldest element to make room
+    reject,    ///< leave the queue alone and report failure
+  };
+
+private:
+  T* buffer;
+  size_t mask;
+  size_t head;
+  size_t tail;
+  FullPolicy policy;
+
+public:
+  /**
+    Construct an empty queue.
+
+    @param  capacity  The number of elements to make room for, rounded
+                      up to a power of two
+    @param  policy    What to do when pushing into a full queue
+  */
+  explicit RingQueue(size_t capacity = 16,
+                     FullPolicy policy = FullPolicy::grow);
+
+  /**
+    Construct the queue from the logical contents, front first.
+
+    @param  contents  Those elements which make up the queue.
+  */
+  RingQueue(std::initializer_list<T> contents);
+
+  /**
+    Construct a copy of a queue.
+  */
+  RingQueue(const RingQueue& other);
+
+  /**
+    Move the queue to a new place, leaving the old one empty with a
+    capacity of 0.
+  */
+  RingQueue(RingQueue&& other) noexcept;
+
+  /**
+    Assign the queue a copy of another queue.
+  */
+  RingQueue& operator=(const RingQueue& other);
+
+  /**
+    Move data from another queue to this queue.
+  */
+  RingQueue& operator=(RingQueue&& other) noexcept;
+
+  /**
+    Destroy the queue.
+  */
+  ~RingQueue();
+
+  /**
+    The number of elements in the queue.
+  */
+  size_t size() const;
+
+  /**
+    The number of elements the queue can hold before it is full.
+  */
+  size_t capacity() const;
+
+  /**
+    Check if there are exactly 0 elements in the queue.
+  */
+  bool empty() const;
+
+  /**
+    Check if every slot in the queue is taken.
+  */
+  bool full() const;
+
+  /**
+    The value of the oldest item in the queue.
+
+    Should the queue be empty, this method will result in undefined
+    behaviour, likely a crash.
+
+    @return The datum next to be popped
+    {
+  */
+  T& front();
+  const T& cfront() const;
+  /**}*/
+
+  /**
+    The value of the newest item in the queue.
+
+    Should the queue be empty, this method will result in undefined
+    behaviour, likely a crash.
+
+    @return The datum most recently pushed
+    {
+  */
+  T& back();
+  const T& cback() const;
+  /**}*/
+
+  /**
+    Add the given value to the end of the queue.
+
+    @param  new_value   The datum to be added to the queue
+
+    @return False if the queue was full and rejects new data, otherwise
+            true
+  */
+  bool push_back(const T& new_value);
+
+  /**
+    Remove the first item from the queue and return it.
+
+    Should the queue be empty, this method will result in undefined
+    behaviour, likely a crash.
+
+    @return The datum formerly at the start of the queue
+  */
+  T pop_front();
+
+  /**
+    Remove all elements from the queue, keeping its capacity.
+  */
+  void clear();
+
+private:
+  T* slot(size_t index) const;
+  void grow();
+};
+
+#include "RingQueue.inl"
+
+} // namespace DataStructures
+
+#endif
@@ -0,0 +1,219 @@
+// inlined in RingQueue.h
+
+template<typename T>
+DataStructures::RingQueue<T>::RingQueue(size_t capacity, FullPolicy policy)
+{
+  size_t rounded_capacity = 1;
+  while (rounded_capacity < capacity)
+    rounded_capacity <<= 1;
+  buffer = static_cast<T*>(::operator new(rounded_capacity * sizeof(T)));
+  mask = rounded_capacity - 1;
+  head = 0;
+  tail = 0;
+  this->policy = policy;
+}
+
+template<typename T>
+DataStructures::RingQueue<T>::RingQueue(std::initializer_list<T> contents)
+  : RingQueue(contents.size())
+{
+  for (const T& datum : contents)
+    push_back(datum);
+}
+
+template<typename T>
+DataStructures::RingQueue<T>::RingQueue(const RingQueue& other)
+  : RingQueue(other.capacity(), other.policy)
+{
+  *this = other;
+}
+
+template<typename T>
+RingQueue<T>&
+DataStructures::RingQueue<T>::operator=(const RingQueue& other)
+{
+  if (this == &other)
+    return *this;
+  clear();
+  policy = other.policy;
+  if (capacity() < other.size()) {
+    // allocated before the old buffer goes, so that if it throws this
+    // queue is left empty rather than pointing at freed memory
+    T* larger = static_cast<T*>(::operator new(other.capacity() * sizeof(T)));
+    ::operator delete(buffer);
+    buffer = larger;
+    mask = other.mask;
+  }
+  for (size_t index = other.head; index != other.tail; ++index)
+    push_back(*other.slot(index));
+  return *this;
+}
+
+template<typename T>
+DataStructures::RingQueue<T>::RingQueue(RingQueue&& other) noexcept
+  : buffer(nullptr)
+  , mask(SIZE_MAX)
+  , head(0)
+  , tail(0)
+  , policy(other.policy)
+{
+  // the other queue is left with no buffer and a capacity of 0, which
+  // the next push_back grows out of
+  *this = std::move(other);
+}
+
+template<typename T>
+RingQueue<T>&
+DataStructures::RingQueue<T>::operator=(RingQueue&& other) noexcept
+{
+  if (this == &other)
+    return *this;
+  std::swap(buffer, other.buffer);
+  std::swap(mask, other.mask);
+  std::swap(head, other.head);
+  std::swap(tail, other.tail);
+  std::swap(policy, other.policy);
+  return *this;
+}
+
+template<typename T>
+DataStructures::RingQueue<T>::~RingQueue()
+{
+  clear();
+  ::operator delete(buffer);
+}
+
+template<typename T>
+size_t
+DataStructures::RingQueue<T>::size() const
+{
+  return tail - head;
+}
+
+template<typename T>
+size_t
+DataStructures::RingQueue<T>::capacity() const
+{
+  return mask + 1;
+}
+
+template<typename T>
+bool
+DataStructures::RingQueue<T>::empty() const
+{
+  return head == tail;
+}
+
+template<typename T>
+bool
+DataStructures::RingQueue<T>::full() const
+{
+  return size() == capacity();
+}
+
+template<typename T>
+T&
+DataStructures::RingQueue<T>::front()
+{
+  assert(!empty());
+  return *slot(head);
+}
+
+template<typename T>
+const T&
+DataStructures::RingQueue<T>::cfront() const
+{
+  assert(!empty());
+  return *slot(head);
+}
+
+template<typename T>
+T&
+DataStructures::RingQueue<T>::back()
+{
+  assert(!empty());
+  return *slot(tail - 1);
+}
+
+template<typename T>
+const T&
+DataStructures::RingQueue<T>::cback() const
+{
+  assert(!empty());
+  return *slot(tail - 1);
+}
+
+template<typename T>
+bool
+DataStructures::RingQueue<T>::push_back(const T& new_value)
+{
+  if (!full()) {
+    new (slot(tail)) T(new_value);
+    tail += 1;
+    return true;
+  }
+  if (policy == FullPolicy::reject && capacity() > 0)
+    return false;
+
+  // the value may be one of the elements, which making room would move
+  // or destroy, so it is copied out first
+  T copy{ new_value };
+  if (policy == FullPolicy::overwrite && capacity() > 0) {
+    slot(head)->~T();
+    head += 1;
+  } else {
+    grow();
+  }
+  new (slot(tail)) T(std::move(copy));
+  tail += 1;
+  return true;
+}
+
+template<typename T>
+T
+DataStructures::RingQueue<T>::pop_front()
+{
+  assert(!empty());
+  T* old_front = slot(head);
+  T old_front_datum = std::move(*old_front);
+  old_front->~T();
+  head += 1;
+  return old_front_datum;
+}
+
+template<typename T>
+void
+DataStructures::RingQueue<T>::clear()
+{
+  for (; head != tail; ++head)
+    slot(head)->~T();
+  head = 0;
+  tail = 0;
+}
+
+template<typename T>
+T*
+DataStructures::RingQueue<T>::slot(size_t index) const
+{
+  // the indices only ever count up and wrap on their own, so the slot is
+  // always the low bits whatever the capacity
+  return buffer + (index & mask);
+}
+
+template<typename T>
+void
+DataStructures::RingQueue<T>::grow()
+{
+  size_t new_capacity = capacity() == 0 ? 1 : 2 * capacity();
+  T* new_buffer = static_cast<T*>(::operator new(new_capacity * sizeof(T)));
+  size_t new_tail = 0;
+  for (; head != tail; ++head, ++new_tail) {
+    new (new_buffer + new_tail) T(std::move(*slot(head)));
+    slot(head)->~T();
+  }
+  ::operator delete(buffer);
+  buffer = new_buffer;
+  mask = new_capacity - 1;
+  head = 0;
+  tail = new_tail;
+}
@@ -0,0 +1,226 @@
+#ifndef __DATA_STRUCTURES_SKIP_LIST
+#define __DATA_STRUCTURES_SKIP_LIST
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <new>
+
+namespace DataStructures {
+
+/**
+  An ordered set kept as a tower of sorted linked lists.
+
+  Each element sits on the bottom list and, with probability
+  `level_probability` per level, on each list above it, so `find`,
+  `insert`, `erase` and `lower_bound` take expected O(log n) steps.
+
+  When `Concurrent` is true, `insert`, `find`, `lower_bound` and
+  iteration may be called from many threads at once and never block.
+  `erase`, `clear` and assignment still need exclusive access to the
+  list, since nothing here knows when another thread has stopped looking
+  at an unlinked node.
+*/
+template<typename T, typename Compare = std::less<T>, bool Concurrent = false>
+class SkipList
+{
+public:
+  /**
+    The number of lists an element can be on, which bounds the
+    expected-logarithmic behaviour to lists of about 2^32 elements.
+  */
+  static constexpr size_t max_height = 32;
+
+private:
+  struct Element
+  {
+    T datum;
+    size_t height;
+    std::atomic<Element*>* next;
+  };
+
+  std::atomic<Element*> heads[max_height];
+  std::atomic<size_t> height;
+  std::atomic<size_t> number_of_elements;
+  std::atomic<uint64_t> seed;
+  uint64_t promotion_threshold;
+  Compare less;
+
+  // the links are only read with acquire and written with release when
+  // other threads may be following them
+  static constexpr std::memory_order load_order =
+    Concurrent ? std::memory_order_acquire : std::memory_order_relaxed;
+  static constexpr std::memory_order store_order =
+    Concurrent ? std::memory_order_release : std::memory_order_relaxed;
+  static constexpr double random_range = 9007199254740992.0; // 2^53
+
+public:
+  /**
+    A type for iterating forward through the list in ascending order.
+  */
+  class iterator
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+  private:
+    Element* current;
+    friend class SkipList;
+
+  public:
+    explicit iterator(Element* start);
+    explicit iterator()
+      : current(nullptr)
+    {}
+    iterator& operator++();
+    bool operator==(iterator other) const;
+    bool operator!=(iterator other) const;
+    const T& operator*() const;
+  };
+
+  /**
+    An iterator to the least element of the list.
+  */
+  iterator begin() const;
+
+  /**
+    An iterator to the terminus of the list.
+  */
+  iterator end() const;
+
+  /**
+    Construct an empty list.
+
+    @param  level_probability   The chance an element on one level is
+                                also on the next, in (0, 1)
+  */
+  explicit SkipList(double level_probability = 0.5);
+
+  /**
+    Construct the list from the given contents, dropping duplicates.
+
+    @param  contents  Those elements which make up the list.
+  */
+  SkipList(std::initializer_list<T> contents);
+
+  /**
+    Construct a copy of a list.
+  */
+  SkipList(const SkipList& other);
+
+  /**
+    Move the list to a new place.
+  */
+  SkipList(SkipList&& other) noexcept;
+
+  /**
+    Assign the list a copy of another list.
+  */
+  SkipList& operator=(const SkipList& other);
+
+  /**
+    Move data from another list to this list.
+  */
+  SkipList& operator=(SkipList&& other) noexcept;
+
+  /**
+    Destroy the list.
+  */
+  ~SkipList();
+
+  /**
+    The number of elements in the list.
+  */
+  size_t size() const;
+
+  /**
+    Check if there are exactly 0 elements in the list.
+  */
+  bool empty() const;
+
+  /**
+    Add the given value to the list, unless an equivalent one is
+    already there.
+
+    @param  new_value   The datum to be added to the list
+
+    @return True if new_value was added, otherwise false
+  */
+  bool insert(const T& new_value);
+
+  /**
+    Find the element equivalent to the given value.
+
+    @param  value   That value whose equivalent is sought
+
+    @return An iterator to the element, or end() if there is none
+  */
+  iterator find(const T& value) const;
+
+  /**
+    Find the first element that does not order before the given value.
+
+    @param  value   The bound to search from
+
+    @return An iterator to the element, or end() if there is none
+  */
+  iterator lower_bound(const T& value) const;
+
+  /**
+    The number of lists the element is on, which is 1 plus the number of
+    times it was promoted when inserted.
+
+    @param  position  An iterator to the element, which mustn't be end()
+  */
+  size_t tower_height(iterator position) const;
+
+  /**
+    Delete the element equivalent to the given value.
+
+    @param  value   That value whose equivalent will be tossed out.
+
+    @return True if value had an equivalent to be removed, otherwise false
+  */
+  bool erase(const T& value);
+
+  /**
+    Remove all elements from the list.
+  */
+  void clear();
+
+private:
+  static Element* create(const T& datum, size_t height);
+  static void destroy(Element* element);
+
+  /**
+    Point the link at element, failing if a concurrent insert changed
+    it away from expected first.
+  */
+  static bool link(std::atomic<Element*>& link,
+                   Element* expected,
+                   Element* element);
+
+  size_t random_height();
+
+  /**
+    Walk down the towers, recording for each level the link that would
+    have to change to put value on that level and the element it points
+    to now.
+  */
+  void find_links(const T& value,
+                  std::atomic<Element*>** links,
+                  Element** successors) const;
+};
+
+#include "SkipList.inl"
+
+} // namespace DataStructures
+
+#endif
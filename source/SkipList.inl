@@ -0,0 +1,385 @@
+// inlined in SkipList.h
+
+template<typename T, typename Compare, bool Concurrent>
+DataStructures::SkipList<T, Compare, Concurrent>::iterator::iterator(
+  Element* start)
+{
+  current = start;
+}
+
+template<typename T, typename Compare, bool Concurrent>
+typename SkipList<T, Compare, Concurrent>::iterator&
+DataStructures::SkipList<T, Compare, Concurrent>::iterator::operator++()
+{
+  current = current->next[0].load(load_order);
+  return *this;
+}
+
+template<typename T, typename Compare, bool Concurrent>
+bool
+DataStructures::SkipList<T, Compare, Concurrent>::iterator::operator==(
+  const iterator other) const
+{
+  return current == other.current;
+}
+
+template<typename T, typename Compare, bool Concurrent>
+bool
+DataStructures::SkipList<T, Compare, Concurrent>::iterator::operator!=(
+  const iterator other) const
+{
+  return current != other.current;
+}
+
+template<typename T, typename Compare, bool Concurrent>
+const T&
+DataStructures::SkipList<T, Compare, Concurrent>::iterator::operator*() const
+{
+  return current->datum;
+}
+
+template<typename T, typename Compare, bool Concurrent>
+typename SkipList<T, Compare, Concurrent>::iterator
+DataStructures::SkipList<T, Compare, Concurrent>::begin() const
+{
+  return iterator{ heads[0].load(load_order) };
+}
+
+template<typename T, typename Compare, bool Concurrent>
+typename SkipList<T, Compare, Concurrent>::iterator
+DataStructures::SkipList<T, Compare, Concurrent>::end() const
+{
+  return iterator{};
+}
+
+template<typename T, typename Compare, bool Concurrent>
+DataStructures::SkipList<T, Compare, Concurrent>::SkipList(
+  double level_probability)
+  : height(0)
+  , number_of_elements(0)
+  , seed(0)
+{
+  assert(0.0 < level_probability && level_probability < 1.0);
+  for (auto& head : heads)
+    head.store(nullptr, std::memory_order_relaxed);
+  promotion_threshold =
+    static_cast<uint64_t>(level_probability * random_range);
+}
+
+template<typename T, typename Compare, bool Concurrent>
+DataStructures::SkipList<T, Compare, Concurrent>::SkipList(
+  std::initializer_list<T> contents)
+  : SkipList()
+{
+  for (const T& datum : contents)
+    insert(datum);
+}
+
+template<typename T, typename Compare, bool Concurrent>
+DataStructures::SkipList<T, Compare, Concurrent>::SkipList(
+  const SkipList& other)
+  : SkipList()
+{
+  *this = other;
+}
+
+template<typename T, typename Compare, bool Concurrent>
+SkipList<T, Compare, Concurrent>&
+DataStructures::SkipList<T, Compare, Concurrent>::operator=(
+  const SkipList& other)
+{
+  if (this == &other)
+    return *this;
+  clear();
+  promotion_threshold = other.promotion_threshold;
+  less = other.less;
+
+  // other is already sorted, so each element goes on the end of every
+  // level it reaches and no searching is needed
+  std::atomic<Element*>* tails[max_height];
+  for (size_t level = 0; level < max_height; ++level)
+    tails[level] = &heads[level];
+  size_t new_height = 0;
+  for (const T& datum : other) {
+    Element* element = create(datum, random_height());
+    for (size_t level = 0; level < element->height; ++level) {
+      tails[level]->store(element, std::memory_order_relaxed);
+      tails[level] = &element->next[level];
+    }
+    if (element->height > new_height)
+      new_height = element->height;
+  }
+  height.store(new_height, std::memory_order_relaxed);
+  number_of_elements.store(other.size(), store_order);
+  return *this;
+}
+
+template<typename T, typename Compare, bool Concurrent>
+DataStructures::SkipList<T, Compare, Concurrent>::SkipList(
+  SkipList&& other) noexcept
+  : SkipList()
+{
+  *this = std::move(other);
+}
+
+template<typename T, typename Compare, bool Concurrent>
+SkipList<T, Compare, Concurrent>&
+DataStructures::SkipList<T, Compare, Concurrent>::operator=(
+  SkipList&& other) noexcept
+{
+  if (this == &other)
+    return *this;
+
+  for (size_t level = 0; level < max_height; ++level) {
+    Element* new_head = other.heads[level].load(std::memory_order_relaxed);
+    other.heads[level].store(heads[level].load(std::memory_order_relaxed),
+                             std::memory_order_relaxed);
+    heads[level].store(new_head, std::memory_order_relaxed);
+  }
+  size_t new_height = other.height.load(std::memory_order_relaxed);
+  other.height.store(height.load(std::memory_order_relaxed),
+                     std::memory_order_relaxed);
+  height.store(new_height, std::memory_order_relaxed);
+
+  size_t new_number_of_elements =
+    other.number_of_elements.load(std::memory_order_relaxed);
+  other.number_of_elements.store(
+    number_of_elements.load(std::memory_order_relaxed),
+    std::memory_order_relaxed);
+  number_of_elements.store(new_number_of_elements, store_order);
+
+  std::swap(promotion_threshold, other.promotion_threshold);
+  std::swap(less, other.less);
+  return *this;
+}
+
+template<typename T, typename Compare, bool Concurrent>
+DataStructures::SkipList<T, Compare, Concurrent>::~SkipList()
+{
+  clear();
+}
+
+template<typename T, typename Compare, bool Concurrent>
+size_t
+DataStructures::SkipList<T, Compare, Concurrent>::size() const
+{
+  return number_of_elements.load(load_order);
+}
+
+template<typename T, typename Compare, bool Concurrent>
+bool
+DataStructures::SkipList<T, Compare, Concurrent>::empty() const
+{
+  return size() == 0;
+}
+
+template<typename T, typename Compare, bool Concurrent>
+bool
+DataStructures::SkipList<T, Compare, Concurrent>::insert(const T& new_value)
+{
+  std::atomic<Element*>* links[max_height];
+  Element* successors[max_height];
+  Element* element = nullptr;
+
+  // the bottom level decides membership, so once the element is there
+  // it is in the list and the other levels are only shortcuts to it
+  while (true) {
+    find_links(new_value, links, successors);
+    if (successors[0] != nullptr && !less(new_value, successors[0]->datum)) {
+      if (element != nullptr)
+        destroy(element);
+      return false;
+    }
+    if (element == nullptr)
+      element = create(new_value, random_height());
+    for (size_t level = 0; level < element->height; ++level)
+      element->next[level].store(successors[level], std::memory_order_relaxed);
+    if (link(*links[0], successors[0], element))
+      break;
+  }
+
+  for (size_t level = 1; level < element->height; ++level) {
+    while (!link(*links[level], successors[level], element)) {
+      find_links(new_value, links, successors);
+      element->next[level].store(successors[level], std::memory_order_relaxed);
+    }
+  }
+
+  size_t old_height = height.load(std::memory_order_relaxed);
+  while (old_height < element->height &&
+         !height.compare_exchange_weak(
+           old_height, element->height, std::memory_order_relaxed)) {
+  }
+  number_of_elements.fetch_add(1, store_order);
+  return true;
+}
+
+template<typename T, typename Compare, bool Concurrent>
+typename SkipList<T, Compare, Concurrent>::iterator
+DataStructures::SkipList<T, Compare, Concurrent>::find(const T& value) const
+{
+  iterator candidate = lower_bound(value);
+  if (candidate != end() && !less(value, *candidate))
+    return candidate;
+  return end();
+}
+
+template<typename T, typename Compare, bool Concurrent>
+typename SkipList<T, Compare, Concurrent>::iterator
+DataStructures::SkipList<T, Compare, Concurrent>::lower_bound(
+  const T& value) const
+{
+  const std::atomic<Element*>* current = heads;
+  Element* successor = nullptr;
+  for (size_t level = height.load(std::memory_order_relaxed); level-- > 0;) {
+    successor = current[level].load(load_order);
+    while (successor != nullptr && less(successor->datum, value)) {
+      current = successor->next;
+      successor = current[level].load(load_order);
+    }
+  }
+  return iterator{ successor };
+}
+
+template<typename T, typename Compare, bool Concurrent>
+size_t
+DataStructures::SkipList<T, Compare, Concurrent>::tower_height(
+  iterator position) const
+{
+  assert(position.current != nullptr);
+  return position.current->height;
+}
+
+template<typename T, typename Compare, bool Concurrent>
+bool
+DataStructures::SkipList<T, Compare, Concurrent>::erase(const T& value)
+{
+  std::atomic<Element*>* links[max_height];
+  Element* successors[max_height];
+  find_links(value, links, successors);
+
+  Element* element = successors[0];
+  if (element == nullptr || less(value, element->datum))
+    return false;
+  for (size_t level = 0; level < element->height; ++level)
+    links[level]->store(element->next[level].load(std::memory_order_relaxed),
+                        std::memory_order_relaxed);
+  destroy(element);
+
+  size_t new_height = height.load(std::memory_order_relaxed);
+  while (new_height > 0 &&
+         heads[new_height - 1].load(std::memory_order_relaxed) == nullptr)
+    new_height -= 1;
+  height.store(new_height, std::memory_order_relaxed);
+  number_of_elements.fetch_sub(1, store_order);
+  return true;
+}
+
+template<typename T, typename Compare, bool Concurrent>
+void
+DataStructures::SkipList<T, Compare, Concurrent>::clear()
+{
+  Element* current = heads[0].load(std::memory_order_relaxed);
+  while (current != nullptr) {
+    Element* next = current->next[0].load(std::memory_order_relaxed);
+    destroy(current);
+    current = next;
+  }
+  for (auto& head : heads)
+    head.store(nullptr, std::memory_order_relaxed);
+  height.store(0, std::memory_order_relaxed);
+  number_of_elements.store(0, store_order);
+}
+
+template<typename T, typename Compare, bool Concurrent>
+typename SkipList<T, Compare, Concurrent>::Element*
+DataStructures::SkipList<T, Compare, Concurrent>::create(const T& datum,
+                                                         size_t height)
+{
+  // the tower of links is allocated right behind the element so that
+  // each element costs one allocation whatever its height
+  void* memory =
+    ::operator new(sizeof(Element) + height * sizeof(std::atomic<Element*>));
+  auto* next = reinterpret_cast<std::atomic<Element*>*>(
+    static_cast<char*>(memory) + sizeof(Element));
+  for (size_t level = 0; level < height; ++level)
+    new (&next[level]) std::atomic<Element*>(nullptr);
+  try {
+    return new (memory) Element{ datum, height, next };
+  } catch (...) {
+    ::operator delete(memory);
+    throw;
+  }
+}
+
+template<typename T, typename Compare, bool Concurrent>
+void
+DataStructures::SkipList<T, Compare, Concurrent>::destroy(Element* element)
+{
+  element->~Element();
+  ::operator delete(element);
+}
+
+template<typename T, typename Compare, bool Concurrent>
+bool
+DataStructures::SkipList<T, Compare, Concurrent>::link(
+  std::atomic<Element*>& link,
+  Element* expected,
+  Element* element)
+{
+  if (Concurrent)
+    return link.compare_exchange_strong(expected,
+                                        element,
+                                        std::memory_order_release,
+                                        std::memory_order_relaxed);
+  link.store(element, std::memory_order_relaxed);
+  return true;
+}
+
+template<typename T, typename Compare, bool Concurrent>
+size_t
+DataStructures::SkipList<T, Compare, Concurrent>::random_height()
+{
+  const uint64_t golden = 0x9e3779b97f4a7c15;
+  auto mix = [](uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+    return z ^ (z >> 31);
+  };
+
+  // one step of a shared counter per call, so concurrent inserters
+  // need no lock, hashed into a state of this call's own; stepping the
+  // counter's value itself would walk the lattice the next call starts
+  // on, and each height would be the last one less one
+  uint64_t state =
+    mix(seed.fetch_add(golden, std::memory_order_relaxed) + golden);
+  size_t new_height = 1;
+  while (new_height < max_height) {
+    state += golden;
+    if ((mix(state) >> 11) >= promotion_threshold)
+      break;
+    new_height += 1;
+  }
+  return new_height;
+}
+
+template<typename T, typename Compare, bool Concurrent>
+void
+DataStructures::SkipList<T, Compare, Concurrent>::find_links(
+  const T& value,
+  std::atomic<Element*>** links,
+  Element** successors) const
+{
+  // every level is walked, not just those below height, as a concurrent
+  // insert may already have linked an element above the recorded height
+  auto* current = const_cast<std::atomic<Element*>*>(heads);
+  for (size_t level = max_height; level-- > 0;) {
+    Element* successor = current[level].load(load_order);
+    while (successor != nullptr && less(successor->datum, value)) {
+      current = successor->next;
+      successor = current[level].load(load_order);
+    }
+    links[level] = &current[level];
+    successors[level] = successor;
+  }
+}
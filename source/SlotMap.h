@@ -0,0 +1,217 @@
+#ifndef __DATA_STRUCTURES_SLOT_MAP
+#define __DATA_STRUCTURES_SLOT_MAP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <vector>
+
+namespace DataStructures {
+
+/**
+  An unordered collection whose elements are reached through handles
+  that stay valid until that element, and only that element, is erased.
+
+  The elements are packed together in one array, so iterating is as
+  fast as over a `std::vector`.  Keeping them packed means an erase
+  fills the gap with the last element, so iteration follows insertion
+  order only until the first erase.  Each handle names a slot whose
+  generation counts how often it was filled and emptied, so a handle to
+  an erased element is recognised as stale rather than reaching
+  whatever element took its place.
+*/
+template<typename T>
+class SlotMap
+{
+public:
+  /**
+    A 64 bit reference to an element of the map.
+
+    A default constructed handle never refers to an element.
+  */
+  struct handle
+  {
+    // no slot has this index, and an even generation is never live
+    uint32_t slot = UINT32_MAX;
+    uint32_t generation = 0;
+
+    bool operator==(handle other) const;
+    bool operator!=(handle other) const;
+  };
+
+private:
+  struct Slot
+  {
+    // where the element is in data while the slot is filled, and the
+    // next free slot while it isn't
+    uint32_t index;
+    // odd while the slot is filled and even while it is free
+    uint32_t generation;
+  };
+
+  static constexpr uint32_t no_slot = UINT32_MAX;
+
+  std::vector<T> data;
+  std::vector<uint32_t> data_slots;
+  std::vector<Slot> slots;
+  uint32_t free_slots;
+
+public:
+  /**
+    A type for iterating forward through the elements of the map.
+  */
+  class iterator
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+
+  private:
+    T* current;
+
+  public:
+    explicit iterator(T* start);
+    explicit iterator()
+      : current(nullptr)
+    {}
+    iterator& operator++();
+    bool operator==(iterator other) const;
+    bool operator!=(iterator other) const;
+    T& operator*() const;
+  };
+
+  /**
+    A type for iterating forward through the elements of a map that
+    mustn't be changed.
+  */
+  class const_iterator
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+  private:
+    const T* current;
+
+  public:
+    explicit const_iterator(const T* start);
+    explicit const_iterator()
+      : current(nullptr)
+    {}
+    const_iterator& operator++();
+    bool operator==(const_iterator other) const;
+    bool operator!=(const_iterator other) const;
+    const T& operator*() const;
+  };
+
+  /**
+    An iterator to the start of the map.
+    {
+  */
+  iterator begin();
+  const_iterator begin() const;
+  /**}*/
+
+  /**
+    An iterator to the terminus of the map.
+    {
+  */
+  iterator end();
+  const_iterator end() const;
+  /**}*/
+
+  /**
+    Construct an empty map.
+  */
+  SlotMap();
+
+  /**
+    Construct the map from the logical contents.
+
+    @param  contents  Those elements which make up the map.
+  */
+  SlotMap(std::initializer_list<T> contents);
+
+  /**
+    The number of elements in the map.
+  */
+  size_t size() const;
+
+  /**
+    Check if there are exactly 0 elements in the map.
+  */
+  bool empty() const;
+
+  /**
+    Add the given value to the map.
+
+    @param  new_value   The datum to be added to the map
+
+    @return A handle to the new element
+  */
+  handle insert(const T& new_value);
+
+  /**
+    Check if the handle refers to an element of this map.
+
+    @param  element   The handle in question
+  */
+  bool contains(handle element) const;
+
+  /**
+    The element the handle refers to.
+
+    @param  element   A handle from this map
+
+    @return A pointer to the element, or nullptr if it was erased
+    {
+  */
+  T* find(handle element);
+  const T* find(handle element) const;
+  /**}*/
+
+  /**
+    The element the handle refers to.
+
+    Should the element have been erased, this method will result in
+    undefined behaviour, likely a crash.
+
+    @param  element   A handle from this map
+    {
+  */
+  T& operator[](handle element);
+  const T& operator[](handle element) const;
+  /**}*/
+
+  /**
+    Delete the element the handle refers to.
+
+    The last element of the map is moved into its place, so iteration
+    order is insertion order only until the first erase.  Handles to
+    every other element stay valid.
+
+    @param  element   A handle from this map
+
+    @return True if the element was there to be removed, otherwise false
+  */
+  bool erase(handle element);
+
+  /**
+    Remove all elements from the map, making every handle stale.
+  */
+  void clear();
+};
+
+#include "SlotMap.inl"
+
+} // namespace DataStructures
+
+#endif
@@ -0,0 +1,243 @@
+// inlined in SlotMap.h
+
+template<typename T>
+bool
+DataStructures::SlotMap<T>::handle::operator==(const handle other) const
+{
+  return slot == other.slot && generation == other.generation;
+}
+
+template<typename T>
+bool
+DataStructures::SlotMap<T>::handle::operator!=(const handle other) const
+{
+  return !operator==(other);
+}
+
+template<typename T>
+DataStructures::SlotMap<T>::iterator::iterator(T* start)
+{
+  current = start;
+}
+
+template<typename T>
+typename SlotMap<T>::iterator&
+DataStructures::SlotMap<T>::iterator::operator++()
+{
+  ++current;
+  return *this;
+}
+
+template<typename T>
+bool
+DataStructures::SlotMap<T>::iterator::operator==(const iterator other) const
+{
+  return current == other.current;
+}
+
+template<typename T>
+bool
+DataStructures::SlotMap<T>::iterator::operator!=(const iterator other) const
+{
+  return current != other.current;
+}
+
+template<typename T>
+T&
+DataStructures::SlotMap<T>::iterator::operator*() const
+{
+  return *current;
+}
+
+template<typename T>
+DataStructures::SlotMap<T>::const_iterator::const_iterator(const T* start)
+{
+  current = start;
+}
+
+template<typename T>
+typename SlotMap<T>::const_iterator&
+DataStructures::SlotMap<T>::const_iterator::operator++()
+{
+  ++current;
+  return *this;
+}
+
+template<typename T>
+bool
+DataStructures::SlotMap<T>::const_iterator::operator==(
+  const const_iterator other) const
+{
+  return current == other.current;
+}
+
+template<typename T>
+bool
+DataStructures::SlotMap<T>::const_iterator::operator!=(
+  const const_iterator other) const
+{
+  return current != other.current;
+}
+
+template<typename T>
+const T&
+DataStructures::SlotMap<T>::const_iterator::operator*() const
+{
+  return *current;
+}
+
+template<typename T>
+typename SlotMap<T>::iterator
+DataStructures::SlotMap<T>::begin()
+{
+  return iterator{ data.data() };
+}
+
+template<typename T>
+typename SlotMap<T>::const_iterator
+DataStructures::SlotMap<T>::begin() const
+{
+  return const_iterator{ data.data() };
+}
+
+template<typename T>
+typename SlotMap<T>::iterator
+DataStructures::SlotMap<T>::end()
+{
+  return iterator{ data.data() + data.size() };
+}
+
+template<typename T>
+typename SlotMap<T>::const_iterator
+DataStructures::SlotMap<T>::end() const
+{
+  return const_iterator{ data.data() + data.size() };
+}
+
+template<typename T>
+DataStructures::SlotMap<T>::SlotMap()
+{
+  free_slots = no_slot;
+}
+
+template<typename T>
+DataStructures::SlotMap<T>::SlotMap(std::initializer_list<T> contents)
+  : SlotMap()
+{
+  data.reserve(contents.size());
+  data_slots.reserve(contents.size());
+  slots.reserve(contents.size());
+  for (const T& datum : contents)
+    insert(datum);
+}
+
+template<typename T>
+size_t
+DataStructures::SlotMap<T>::size() const
+{
+  return data.size();
+}
+
+template<typename T>
+bool
+DataStructures::SlotMap<T>::empty() const
+{
+  return data.empty();
+}
+
+template<typename T>
+typename SlotMap<T>::handle
+DataStructures::SlotMap<T>::insert(const T& new_value)
+{
+  uint32_t slot = free_slots;
+  if (slot != no_slot) {
+    free_slots = slots[slot].index;
+  } else {
+    assert(slots.size() < no_slot);
+    slot = static_cast<uint32_t>(slots.size());
+    slots.push_back(Slot{ 0, 0 });
+  }
+  data.push_back(new_value);
+  data_slots.push_back(slot);
+  slots[slot].index = static_cast<uint32_t>(data.size() - 1);
+  slots[slot].generation += 1;
+  return handle{ slot, slots[slot].generation };
+}
+
+template<typename T>
+bool
+DataStructures::SlotMap<T>::contains(const handle element) const
+{
+  return element.slot < slots.size() &&
+         slots[element.slot].generation == element.generation &&
+         element.generation % 2 == 1;
+}
+
+template<typename T>
+T*
+DataStructures::SlotMap<T>::find(const handle element)
+{
+  if (!contains(element))
+    return nullptr;
+  return &data[slots[element.slot].index];
+}
+
+template<typename T>
+const T*
+DataStructures::SlotMap<T>::find(const handle element) const
+{
+  if (!contains(element))
+    return nullptr;
+  return &data[slots[element.slot].index];
+}
+
+template<typename T>
+T&
+DataStructures::SlotMap<T>::operator[](const handle element)
+{
+  assert(contains(element));
+  return data[slots[element.slot].index];
+}
+
+template<typename T>
+const T&
+DataStructures::SlotMap<T>::operator[](const handle element) const
+{
+  assert(contains(element));
+  return data[slots[element.slot].index];
+}
+
+template<typename T>
+bool
+DataStructures::SlotMap<T>::erase(const handle element)
+{
+  if (!contains(element))
+    return false;
+
+  Slot& slot = slots[element.slot];
+  uint32_t last = static_cast<uint32_t>(data.size() - 1);
+  if (slot.index != last) {
+    data[slot.index] = std::move(data[last]);
+    data_slots[slot.index] = data_slots[last];
+    slots[data_slots[last]].index = slot.index;
+  }
+  data.pop_back();
+  data_slots.pop_back();
+
+  slot.generation += 1;
+  // a slot whose generation wrapped around is never reused, so that no
+  // old handle can come to refer to a new element
+  if (slot.generation != 0) {
+    slot.index = free_slots;
+    free_slots = element.slot;
+  }
+  return true;
+}
+
+template<typename T>
+void
+DataStructures::SlotMap<T>::clear()
+{
+  while (!data.empty())
+    erase(handle{ data_slots.back(), slots[data_slots.back()].generation });
+}
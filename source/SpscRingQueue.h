@@ -0,0 +1,138 @@
+#ifndef __DATA_STRUCTURES_SPSC_RING_QUEUE
+#define __DATA_STRUCTURES_SPSC_RING_QUEUE
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <new>
+
+namespace DataStructures {
+
+/**
+  A fixed capacity first-in first-out queue for exactly one producer
+  thread and one consumer thread.
+
+  Every operation finishes in a bounded number of steps whatever the
+  other thread is doing.  Only the producer may call `push_back` and
+  `back`, and only the consumer may call `pop_front` and `front`;
+  `size`, `empty` and `full` may be called by either, but are only exact
+  for the consumer and producer respectively.
+*/
+template<typename T>
+class SpscRingQueue
+{
+public:
+  /**
+    The assumed size of a cache line, used to keep the producer's and
+    consumer's indices from sharing one.
+  */
+  static constexpr size_t cache_line_size = 64;
+
+private:
+  T* const buffer;
+  const size_t mask;
+
+  // the consumer's index and its stale copy of the producer's
+  alignas(cache_line_size) std::atomic<size_t> head;
+  size_t cached_tail;
+
+  // the producer's index and its stale copy of the consumer's
+  alignas(cache_line_size) std::atomic<size_t> tail;
+  size_t cached_head;
+
+public:
+  /**
+    Construct an empty queue.
+
+    @param  capacity  The number of elements to make room for, rounded
+                      up to a power of two
+  */
+  explicit SpscRingQueue(size_t capacity);
+
+  SpscRingQueue(const SpscRingQueue& other) = delete;
+  SpscRingQueue& operator=(const SpscRingQueue& other) = delete;
+
+  /**
+    Destroy the queue.
+  */
+  ~SpscRingQueue();
+
+  /**
+    The number of elements in the queue.
+  */
+  size_t size() const;
+
+  /**
+    The number of elements the queue can hold before it is full.
+  */
+  size_t capacity() const;
+
+  /**
+    Check if there are exactly 0 elements in the queue.
+  */
+  bool empty() const;
+
+  /**
+    Check if every slot in the queue is taken.
+  */
+  bool full() const;
+
+  /**
+    The value of the oldest item in the queue.  Consumer only.
+
+    Should the queue be empty, this method will result in undefined
+    behaviour, likely a crash.
+
+    @return The datum next to be popped
+  */
+  T& front();
+
+  /**
+    The value of the newest item in the queue.  Producer only.
+
+    Should the queue be empty, this method will result in undefined
+    behaviour, likely a crash.
+
+    @return The datum most recently pushed
+  */
+  T& back();
+
+  /**
+    Add the given value to the end of the queue.  Producer only.
+
+    @param  new_value   The datum to be added to the queue
+
+    @return False if the queue was full, otherwise true
+  */
+  bool push_back(const T& new_value);
+
+  /**
+    Remove the first item from the queue and return it.  Consumer only.
+
+    Should the queue be empty, this method will result in undefined
+    behaviour, likely a crash.
+
+    @return The datum formerly at the start of the queue
+  */
+  T pop_front();
+
+  /**
+    Remove the first item from the queue if there is one.  Consumer only.
+
+    @param  popped  Where to put the datum formerly at the start of the
+                    queue
+
+    @return False if the queue was empty, otherwise true
+  */
+  bool try_pop_front(T& popped);
+
+private:
+  static size_t round_up_to_power_of_two(size_t capacity);
+  T* slot(size_t index) const;
+};
+
+#include "SpscRingQueue.inl"
+
+} // namespace DataStructures
+
+#endif
@@ -0,0 +1,129 @@
+// inlined in SpscRingQueue.h
+
+template<typename T>
+DataStructures::SpscRingQueue<T>::SpscRingQueue(size_t capacity)
+  : buffer(static_cast<T*>(
+      ::operator new(round_up_to_power_of_two(capacity) * sizeof(T))))
+  , mask(round_up_to_power_of_two(capacity) - 1)
+  , head(0)
+  , cached_tail(0)
+  , tail(0)
+  , cached_head(0)
+{}
+
+template<typename T>
+DataStructures::SpscRingQueue<T>::~SpscRingQueue()
+{
+  size_t end = tail.load(std::memory_order_relaxed);
+  for (size_t index = head.load(std::memory_order_relaxed); index != end;
+       ++index)
+    slot(index)->~T();
+  ::operator delete(buffer);
+}
+
+template<typename T>
+size_t
+DataStructures::SpscRingQueue<T>::size() const
+{
+  return tail.load(std::memory_order_acquire) -
+         head.load(std::memory_order_acquire);
+}
+
+template<typename T>
+size_t
+DataStructures::SpscRingQueue<T>::capacity() const
+{
+  return mask + 1;
+}
+
+template<typename T>
+bool
+DataStructures::SpscRingQueue<T>::empty() const
+{
+  return size() == 0;
+}
+
+template<typename T>
+bool
+DataStructures::SpscRingQueue<T>::full() const
+{
+  return size() == capacity();
+}
+
+template<typename T>
+T&
+DataStructures::SpscRingQueue<T>::front()
+{
+  assert(!empty());
+  return *slot(head.load(std::memory_order_relaxed));
+}
+
+template<typename T>
+T&
+DataStructures::SpscRingQueue<T>::back()
+{
+  assert(!empty());
+  return *slot(tail.load(std::memory_order_relaxed) - 1);
+}
+
+template<typename T>
+bool
+DataStructures::SpscRingQueue<T>::push_back(const T& new_value)
+{
+  size_t index = tail.load(std::memory_order_relaxed);
+  // only go to the consumer's cache line when the stale copy says the
+  // queue is full, which it usually isn't
+  if (index - cached_head == capacity()) {
+    cached_head = head.load(std::memory_order_acquire);
+    if (index - cached_head == capacity())
+      return false;
+  }
+  new (slot(index)) T(new_value);
+  tail.store(index + 1, std::memory_order_release);
+  return true;
+}
+
+template<typename T>
+T
+DataStructures::SpscRingQueue<T>::pop_front()
+{
+  T popped;
+  bool was_popped = try_pop_front(popped);
+  assert(was_popped);
+  (void)was_popped;
+  return popped;
+}
+
+template<typename T>
+bool
+DataStructures::SpscRingQueue<T>::try_pop_front(T& popped)
+{
+  size_t index = head.load(std::memory_order_relaxed);
+  if (index == cached_tail) {
+    cached_tail = tail.load(std::memory_order_acquire);
+    if (index == cached_tail)
+      return false;
+  }
+  T* old_front = slot(index);
+  popped = std::move(*old_front);
+  old_front->~T();
+  head.store(index + 1, std::memory_order_release);
+  return true;
+}
+
+template<typename T>
+size_t
+DataStructures::SpscRingQueue<T>::round_up_to_power_of_two(size_t capacity)
+{
+  size_t rounded_capacity = 1;
+  while (rounded_capacity < capacity)
+    rounded_capacity <<= 1;
+  return rounded_capacity;
+}
+
+template<typename T>
+T*
+DataStructures::SpscRingQueue<T>::slot(size_t index) const
+{
+  return buffer + (index & mask);
+}
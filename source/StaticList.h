@@ -0,0 +1,228 @@
+#ifndef __DATA_STRUCTURES_STATIC_LIST
+#define __DATA_STRUCTURES_STATIC_LIST
+
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+
+namespace DataStructures {
+
+/**
+  A singly linked list of at most N elements that never allocates, and
+  that can be built and changed entirely at compile time.
+
+  The elements live in an array inside the list and are linked by index
+  rather than by pointer, with unused places kept on a free list, so a
+  `constexpr` StaticList can be put in read-only data.  T must be
+  default constructible and usable in constant expressions.
+*/
+template<typename T, size_t N>
+class StaticList
+{
+public:
+  static_assert(N > 0, "a static list must have room for something");
+
+private:
+  // the index that links to nothing
+  static constexpr size_t none = N;
+
+  T data[N];
+  size_t next[N];
+  size_t first;
+  size_t last;
+  size_t first_free;
+  size_t number_of_elements;
+
+public:
+  /**
+    A type for iterating forward through the list.
+  */
+  class iterator
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+  private:
+    const StaticList* list;
+    size_t current;
+
+  public:
+    constexpr explicit iterator(const StaticList* list, size_t start);
+    constexpr iterator& operator++();
+    constexpr bool operator==(iterator other) const;
+    constexpr bool operator!=(iterator other) const;
+    constexpr const T& operator*() const;
+  };
+
+  /**
+    An iterator to the start of the list.
+  */
+  constexpr iterator begin() const;
+
+  /**
+    An iterator to the terminus of the list.
+  */
+  constexpr iterator end() const;
+
+  /**
+    Construct the list from the logical contents.
+
+    Should there be more than N of them, this constructor will result in
+    undefined behaviour, likely a crash.
+
+    @param  contents  Those elements which make up the list.
+  */
+  constexpr StaticList(std::initializer_list<T> contents);
+
+  /**
+    Construct an empty list.
+  */
+  constexpr StaticList();
+
+  /**
+    The number of elements in the list.
+  */
+  constexpr size_t size() const;
+
+  /**
+    The number of elements the list has room for, which is N.
+  */
+  constexpr size_t capacity() const;
+
+  /**
+    Check if there are exactly 0 elements in the list.
+  */
+  constexpr bool empty() const;
+
+  /**
+    Check if there is no room for another element.
+  */
+  constexpr bool full() const;
+
+  /**
+    Check if this and that list have equal data.
+
+    @param  other   A list whose equality you're interested in
+  */
+  template<size_t M>
+  constexpr bool operator==(const StaticList<T, M>& other) const;
+
+  /**
+    Check if this and that list have inequal data.
+
+    @param  other   A list whose inequality you're interested in
+  */
+  template<size_t M>
+  constexpr bool operator!=(const StaticList<T, M>& other) const;
+
+  /**
+    The value of the first item in the list.
+
+    Should the list be empty, this method will result in undefined
+    behaviour, likely a crash.
+
+    @return The datum beginning the list
+    {
+  */
+  constexpr T& front();
+  constexpr const T& cfront() const;
+  /**}*/
+
+  /**
+    The value of the last item in the list.
+
+    Should the list be empty, this method will result in undefined
+    behaviour, likely a crash.
+
+    @return The datum terminating the list
+    {
+  */
+  constexpr T& back();
+  constexpr const T& cback() const;
+  /**}*/
+
+  /**
+    Add the given value to the beginning of the list.
+
+    Should the list be full, this method will result in undefined
+    behaviour, likely a crash.
+
+    @param  new_value   The datum to be added to the list
+  */
+  constexpr void push_front(const T& new_value);
+
+  /**
+    Add the given value to the end of the list.
+
+    Should the list be full, this method will result in undefined
+    behaviour, likely a crash.
+
+    @param  new_value   The datum to be added to the list
+  */
+  constexpr void push_back(const T& new_value);
+
+  /**
+    Remove the first item from the list and return it.
+
+    Should the list be empty, this method will result in undefined
+    behaviour, likely a crash.
+
+    @return The datum formerly at the start of the list
+  */
+  constexpr T pop_front();
+
+  /**
+    Remove the last item from the list and return it.
+
+    Should the list be empty, this method will result in undefined
+    behaviour, likely a crash.
+
+    @return The datum that was previously the list's last
+  */
+  constexpr T pop_back();
+
+  /**
+    Remove all elements from the list.
+  */
+  constexpr void clear();
+
+  /**
+    Delete the first element equal to the given value.
+
+    @param  value   That value whose equal will be tossed out.
+
+    @return True if value had an equal to be removed, otherwise false
+  */
+  constexpr bool remove(const T& value);
+
+  /**
+    Apply the given function element-wise to the list.
+
+    @param closure  A function representing the desired mutation, which
+                    must itself be constexpr for this to be
+  */
+  template<typename Closure>
+  constexpr void map(Closure closure);
+
+private:
+  /**
+    Take a place off the free list and put the value in it.
+  */
+  constexpr size_t allocate(const T& new_value);
+
+  /**
+    Put a place back on the free list.
+  */
+  constexpr void deallocate(size_t index);
+};
+
+#include "StaticList.inl"
+
+} // namespace DataStructures
+
+#endif
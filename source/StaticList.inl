@@ -0,0 +1,282 @@
+// inlined in StaticList.h
+
+template<typename T, size_t N>
+constexpr DataStructures::StaticList<T, N>::iterator::iterator(
+  const StaticList* list,
+  size_t start)
+  : list(list)
+  , current(start)
+{}
+
+template<typename T, size_t N>
+constexpr typename StaticList<T, N>::iterator&
+DataStructures::StaticList<T, N>::iterator::operator++()
+{
+  current = list->next[current];
+  return *this;
+}
+
+template<typename T, size_t N>
+constexpr bool
+DataStructures::StaticList<T, N>::iterator::operator==(
+  const iterator other) const
+{
+  return current == other.current;
+}
+
+template<typename T, size_t N>
+constexpr bool
+DataStructures::StaticList<T, N>::iterator::operator!=(
+  const iterator other) const
+{
+  return current != other.current;
+}
+
+template<typename T, size_t N>
+constexpr const T&
+DataStructures::StaticList<T, N>::iterator::operator*() const
+{
+  return list->data[current];
+}
+
+template<typename T, size_t N>
+constexpr typename StaticList<T, N>::iterator
+DataStructures::StaticList<T, N>::begin() const
+{
+  return iterator{ this, first };
+}
+
+template<typename T, size_t N>
+constexpr typename StaticList<T, N>::iterator
+DataStructures::StaticList<T, N>::end() const
+{
+  return iterator{ this, none };
+}
+
+template<typename T, size_t N>
+constexpr DataStructures::StaticList<T, N>::StaticList(
+  std::initializer_list<T> contents)
+  : StaticList()
+{
+  for (const T& datum : contents)
+    push_back(datum);
+}
+
+template<typename T, size_t N>
+constexpr DataStructures::StaticList<T, N>::StaticList()
+  : data{}
+  , next{}
+  , first(none)
+  , last(none)
+  , first_free(0)
+  , number_of_elements(0)
+{
+  for (size_t index = 0; index < N; ++index)
+    next[index] = index + 1;
+}
+
+template<typename T, size_t N>
+constexpr size_t
+DataStructures::StaticList<T, N>::size() const
+{
+  return number_of_elements;
+}
+
+template<typename T, size_t N>
+constexpr size_t
+DataStructures::StaticList<T, N>::capacity() const
+{
+  return N;
+}
+
+template<typename T, size_t N>
+constexpr bool
+DataStructures::StaticList<T, N>::empty() const
+{
+  return number_of_elements == 0;
+}
+
+template<typename T, size_t N>
+constexpr bool
+DataStructures::StaticList<T, N>::full() const
+{
+  return number_of_elements == N;
+}
+
+template<typename T, size_t N>
+template<size_t M>
+constexpr bool
+DataStructures::StaticList<T, N>::operator==(
+  const StaticList<T, M>& other) const
+{
+  if (other.size() != number_of_elements)
+    return false;
+
+  auto other_it = other.begin();
+  for (auto this_it = begin(); this_it != end(); ++this_it) {
+    if (*this_it != *other_it)
+      return false;
+    ++other_it;
+  }
+  return true;
+}
+
+template<typename T, size_t N>
+template<size_t M>
+constexpr bool
+DataStructures::StaticList<T, N>::operator!=(
+  const StaticList<T, M>& other) const
+{
+  return !operator==(other);
+}
+
+template<typename T, size_t N>
+constexpr T&
+DataStructures::StaticList<T, N>::front()
+{
+  assert(!empty());
+  return data[first];
+}
+
+template<typename T, size_t N>
+constexpr const T&
+DataStructures::StaticList<T, N>::cfront() const
+{
+  assert(!empty());
+  return data[first];
+}
+
+template<typename T, size_t N>
+constexpr T&
+DataStructures::StaticList<T, N>::back()
+{
+  assert(!empty());
+  return data[last];
+}
+
+template<typename T, size_t N>
+constexpr const T&
+DataStructures::StaticList<T, N>::cback() const
+{
+  assert(!empty());
+  return data[last];
+}
+
+template<typename T, size_t N>
+constexpr void
+DataStructures::StaticList<T, N>::push_front(const T& new_value)
+{
+  size_t new_first = allocate(new_value);
+  next[new_first] = first;
+  if (first == none)
+    last = new_first;
+  first = new_first;
+}
+
+template<typename T, size_t N>
+constexpr void
+DataStructures::StaticList<T, N>::push_back(const T& new_value)
+{
+  size_t new_last = allocate(new_value);
+  next[new_last] = none;
+  if (last != none)
+    next[last] = new_last;
+  else
+    first = new_last;
+  last = new_last;
+}
+
+template<typename T, size_t N>
+constexpr T
+DataStructures::StaticList<T, N>::pop_front()
+{
+  assert(!empty());
+  size_t old_first = first;
+  first = next[old_first];
+  if (first == none)
+    last = none;
+  T old_first_datum = data[old_first];
+  deallocate(old_first);
+  return old_first_datum;
+}
+
+template<typename T, size_t N>
+constexpr T
+DataStructures::StaticList<T, N>::pop_back()
+{
+  assert(!empty());
+  size_t old_last = last;
+  if (first == old_last) {
+    first = none;
+    last = none;
+  } else {
+    size_t new_last = first;
+    while (next[new_last] != old_last)
+      new_last = next[new_last];
+    next[new_last] = none;
+    last = new_last;
+  }
+  T old_last_datum = data[old_last];
+  deallocate(old_last);
+  return old_last_datum;
+}
+
+template<typename T, size_t N>
+constexpr void
+DataStructures::StaticList<T, N>::clear()
+{
+  *this = StaticList{};
+}
+
+template<typename T, size_t N>
+constexpr bool
+DataStructures::StaticList<T, N>::remove(const T& value)
+{
+  size_t previous_index = none;
+  for (size_t index = first; index != none; index = next[index]) {
+    if (data[index] == value) {
+      if (previous_index == none)
+        first = next[index];
+      else
+        next[previous_index] = next[index];
+      if (index == last)
+        last = previous_index;
+      deallocate(index);
+      return true;
+    }
+    previous_index = index;
+  }
+  return false;
+}
+
+template<typename T, size_t N>
+template<typename Closure>
+constexpr void
+DataStructures::StaticList<T, N>::map(Closure closure)
+{
+  for (size_t index = first; index != none; index = next[index])
+    data[index] = closure(data[index]);
+}
+
+template<typename T, size_t N>
+constexpr size_t
+DataStructures::StaticList<T, N>::allocate(const T& new_value)
+{
+  assert(!full());
+  size_t index = first_free;
+  first_free = next[index];
+  data[index] = new_value;
+  number_of_elements += 1;
+  return index;
+}
+
+template<typename T, size_t N>
+constexpr void
+DataStructures::StaticList<T, N>::deallocate(size_t index)
+{
+  // the datum is reset so that a removed value holds on to nothing
+  data[index] = T{};
+  next[index] = first_free;
+  first_free = index;
+  number_of_elements -= 1;
+}
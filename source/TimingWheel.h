@@ -0,0 +1,183 @@
+#ifndef __DATA_STRUCTURES_TIMING_WHEEL
+#define __DATA_STRUCTURES_TIMING_WHEEL
+
+#include "LinkedList.h"
+
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace DataStructures {
+
+/**
+  A set of timers, each holding a value until a deadline, that are
+  scheduled, cancelled and expired in O(1) each however many there are.
+
+  Time is counted in ticks of whatever length suits.  The wheel has
+  `levels` levels of 256 slots.  A slot on level 0 holds the timers due
+  at one tick, and a slot on level n holds those due in a span of 256^n
+  ticks.  A timer goes in the lowest level whose span still separates
+  its deadline from the current time, and when time reaches a higher
+  slot its timers are spread over the levels below.  Timers further off
+  than 256^levels ticks wait on an overflow list.  The last tick is
+  `UINT64_MAX`; time never wraps around to 0.
+
+  Each slot is an intrusive doubly linked list of timers, which live in
+  a pool and are linked by index.  A handle names a timer by its place
+  in the pool and a generation, as `SlotMap` handles do, so a handle to
+  a timer that expired or was cancelled is recognised as stale.
+*/
+template<typename T>
+class TimingWheel
+{
+public:
+  /**
+    A reference to a scheduled timer.
+
+    A default constructed handle never refers to a timer.
+  */
+  struct handle
+  {
+    uint32_t slot = UINT32_MAX;
+    uint32_t generation = 0;
+
+    bool operator==(handle other) const;
+    bool operator!=(handle other) const;
+  };
+
+  /**
+    The number of levels of slots, which puts any deadline within 2^32
+    ticks of the current time on the wheel.
+  */
+  static constexpr size_t levels = 4;
+
+private:
+  static constexpr size_t slot_bits = 8;
+  static constexpr size_t slots_per_level = size_t{ 1 } << slot_bits;
+  static constexpr size_t words_per_level = slots_per_level / 64;
+  // the list after every slot's list is the overflow list
+  static constexpr size_t overflow = levels * slots_per_level;
+  static constexpr uint32_t no_timer = UINT32_MAX;
+
+  struct Timer
+  {
+    T datum;
+    uint64_t deadline;
+    // the neighbouring timers in the same list while scheduled; the next
+    // free timer while not
+    uint32_t previous;
+    uint32_t next;
+    // which list the timer is in
+    uint32_t list;
+    // odd while scheduled and even while free
+    uint32_t generation;
+  };
+
+  std::vector<Timer> timers;
+  uint32_t free_timers;
+  uint32_t heads[overflow + 1];
+  // a bit for every slot, set while the slot's list isn't empty
+  uint64_t occupied[levels][words_per_level];
+  uint64_t current_time;
+  size_t number_of_timers;
+
+public:
+  /**
+    Construct a wheel with no timers.
+
+    @param  start_time  The tick the wheel starts at
+  */
+  explicit TimingWheel(uint64_t start_time = 0);
+
+  /**
+    The tick the wheel has been advanced to.
+  */
+  uint64_t time() const;
+
+  /**
+    The number of timers scheduled.
+  */
+  size_t size() const;
+
+  /**
+    Check if there are exactly 0 timers scheduled.
+  */
+  bool empty() const;
+
+  /**
+    Schedule a timer.
+
+    A deadline no later than the current time is due at the next tick.
+    Should the current time be `UINT64_MAX`, there being no next tick,
+    this method will result in undefined behaviour, likely a crash.
+
+    @param  deadline  The tick the timer is due at
+    @param  datum     What the timer gives back when it expires
+
+    @return A handle for cancelling the timer
+  */
+  handle schedule(uint64_t deadline, const T& datum);
+
+  /**
+    Check if the handle refers to a timer that is still scheduled.
+
+    @param  timer   A handle from this wheel
+  */
+  bool pending(handle timer) const;
+
+  /**
+    Unschedule a timer.
+
+    @param  timer   A handle from this wheel
+
+    @return True if the timer was scheduled, otherwise false
+  */
+  bool cancel(handle timer);
+
+  /**
+    Move time forward, expiring every timer due by then.
+
+    Only the ticks at which some slot has timers are visited, so a long
+    jump in time costs no more than a short one.  Should the new time be
+    earlier than the current time, this method will result in undefined
+    behaviour, likely a crash.
+
+    @param  now   The tick to move time to
+
+    @return The data of the expired timers, in order of deadline, with
+            timers due at the same tick in no particular order
+  */
+  LinkedList<T> advance(uint64_t now);
+
+private:
+  /**
+    The list a timer due at the deadline belongs in, as of the current
+    time.
+  */
+  uint32_t list_for(uint64_t deadline) const;
+
+  /**
+    Find the next tick after the current time at which some slot has to
+    be expired or spread out.
+
+    @return False if there is no such tick up to now
+  */
+  bool next_event(uint64_t now, uint64_t& tick) const;
+
+  void link(uint32_t index, uint32_t list);
+  void unlink(uint32_t index);
+  void release(uint32_t index);
+
+  /**
+    Take every timer off the list and put it back where it belongs now.
+  */
+  void spread(uint32_t list);
+};
+
+#include "TimingWheel.inl"
+
+} // namespace DataStructures
+
+#endif
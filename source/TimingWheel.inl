@@ -0,0 +1,247 @@
+// inlined in TimingWheel.h
+
+template<typename T>
+bool
+DataStructures::TimingWheel<T>::handle::operator==(const handle other) const
+{
+  return slot == other.slot && generation == other.generation;
+}
+
+template<typename T>
+bool
+DataStructures::TimingWheel<T>::handle::operator!=(const handle other) const
+{
+  return !operator==(other);
+}
+
+template<typename T>
+DataStructures::TimingWheel<T>::TimingWheel(uint64_t start_time)
+  : timers()
+  , free_timers(no_timer)
+  , occupied()
+  , current_time(start_time)
+  , number_of_timers(0)
+{
+  for (uint32_t& head : heads)
+    head = no_timer;
+}
+
+template<typename T>
+uint64_t
+DataStructures::TimingWheel<T>::time() const
+{
+  return current_time;
+}
+
+template<typename T>
+size_t
+DataStructures::TimingWheel<T>::size() const
+{
+  return number_of_timers;
+}
+
+template<typename T>
+bool
+DataStructures::TimingWheel<T>::empty() const
+{
+  return number_of_timers == 0;
+}
+
+template<typename T>
+typename TimingWheel<T>::handle
+DataStructures::TimingWheel<T>::schedule(uint64_t deadline, const T& datum)
+{
+  uint32_t index = free_timers;
+  if (index == no_timer) {
+    index = static_cast<uint32_t>(timers.size());
+    timers.push_back(Timer{ datum, 0, no_timer, no_timer, 0, 0 });
+  } else {
+    free_timers = timers[index].next;
+    timers[index].datum = datum;
+  }
+
+  assert(current_time < UINT64_MAX);
+  Timer& timer = timers[index];
+  timer.generation += 1;
+  // the current tick has been dealt with, so the soonest is the next one
+  timer.deadline = deadline > current_time ? deadline : current_time + 1;
+  link(index, list_for(timer.deadline));
+  number_of_timers += 1;
+  return handle{ index, timer.generation };
+}
+
+template<typename T>
+bool
+DataStructures::TimingWheel<T>::pending(handle timer) const
+{
+  return timer.slot < timers.size() &&
+         timers[timer.slot].generation == timer.generation &&
+         timer.generation % 2 == 1;
+}
+
+template<typename T>
+bool
+DataStructures::TimingWheel<T>::cancel(handle timer)
+{
+  if (!pending(timer))
+    return false;
+  unlink(timer.slot);
+  release(timer.slot);
+  return true;
+}
+
+template<typename T>
+LinkedList<T>
+DataStructures::TimingWheel<T>::advance(uint64_t now)
+{
+  assert(now >= current_time);
+  LinkedList<T> expired{};
+  uint64_t tick;
+  while (next_event(now, tick)) {
+    current_time = tick;
+
+    // higher slots starting at this tick are spread out first, top down,
+    // as their timers may land in the slots below that start here too
+    if (tick % (uint64_t{ 1 } << (levels * slot_bits)) == 0)
+      spread(overflow);
+    for (size_t level = levels - 1; level > 0; --level) {
+      size_t shift = level * slot_bits;
+      if (tick % (uint64_t{ 1 } << shift) == 0)
+        spread(static_cast<uint32_t>(level * slots_per_level +
+                                     ((tick >> shift) % slots_per_level)));
+    }
+
+    uint32_t list = static_cast<uint32_t>(tick % slots_per_level);
+    while (heads[list] != no_timer) {
+      uint32_t index = heads[list];
+      expired.push_back(timers[index].datum);
+      unlink(index);
+      release(index);
+    }
+  }
+  current_time = now;
+  return expired;
+}
+
+template<typename T>
+uint32_t
+DataStructures::TimingWheel<T>::list_for(uint64_t deadline) const
+{
+  // the lowest level whose span tells the deadline and the current time
+  // apart, which is the highest byte in which they differ
+  uint64_t difference = deadline ^ current_time;
+  size_t level = 0;
+  while (level < levels && (difference >> ((level + 1) * slot_bits)) != 0)
+    level += 1;
+  if (level == levels)
+    return overflow;
+  return static_cast<uint32_t>(
+    level * slots_per_level +
+    ((deadline >> (level * slot_bits)) % slots_per_level));
+}
+
+template<typename T>
+bool
+DataStructures::TimingWheel<T>::next_event(uint64_t now, uint64_t& tick) const
+{
+  bool found = false;
+  uint64_t soonest = 0;
+  for (size_t level = 0; level < levels; ++level) {
+    size_t shift = level * slot_bits;
+    size_t start = (current_time >> shift) % slots_per_level + 1;
+    for (size_t word = start / 64; word < words_per_level; ++word) {
+      uint64_t bits = occupied[level][word];
+      if (word == start / 64)
+        bits &= ~uint64_t{ 0 } << (start % 64);
+      if (bits == 0)
+        continue;
+      uint64_t slot = word * 64 + std::countr_zero(bits);
+      // the tick the slot starts at, in the span current_time is in
+      uint64_t slot_start =
+        (current_time >> (shift + slot_bits) << (shift + slot_bits)) |
+        (slot << shift);
+      if (!found || slot_start < soonest)
+        soonest = slot_start;
+      found = true;
+      break;
+    }
+  }
+  // once the current time is in the last span every later deadline is
+  // in it too, so the overflow list is empty and the start of the next
+  // span, which would wrap around to 0, is never wanted
+  size_t shift = levels * slot_bits;
+  if (heads[overflow] != no_timer &&
+      (current_time >> shift) != (UINT64_MAX >> shift)) {
+    uint64_t span_start = ((current_time >> shift) + 1) << shift;
+    if (!found || span_start < soonest)
+      soonest = span_start;
+    found = true;
+  }
+  tick = soonest;
+  return found && soonest <= now;
+}
+
+template<typename T>
+void
+DataStructures::TimingWheel<T>::link(uint32_t index, uint32_t list)
+{
+  Timer& timer = timers[index];
+  timer.list = list;
+  timer.previous = no_timer;
+  timer.next = heads[list];
+  if (timer.next != no_timer)
+    timers[timer.next].previous = index;
+  else if (list != overflow)
+    occupied[list / slots_per_level][list % slots_per_level / 64] |=
+      uint64_t{ 1 } << (list % 64);
+  heads[list] = index;
+}
+
+template<typename T>
+void
+DataStructures::TimingWheel<T>::unlink(uint32_t index)
+{
+  Timer& timer = timers[index];
+  if (timer.next != no_timer)
+    timers[timer.next].previous = timer.previous;
+  if (timer.previous != no_timer) {
+    timers[timer.previous].next = timer.next;
+    return;
+  }
+  heads[timer.list] = timer.next;
+  if (timer.next == no_timer && timer.list != overflow)
+    occupied[timer.list / slots_per_level][timer.list % slots_per_level / 64] &=
+      ~(uint64_t{ 1 } << (timer.list % 64));
+}
+
+template<typename T>
+void
+DataStructures::TimingWheel<T>::release(uint32_t index)
+{
+  Timer& timer = timers[index];
+  timer.datum = T{};
+  timer.generation += 1;
+  number_of_timers -= 1;
+  // a timer whose generation wrapped around is never reused, so that no
+  // handle from before the wrap can reach a later timer
+  if (timer.generation != 0) {
+    timer.next = free_timers;
+    free_timers = index;
+  }
+}
+
+template<typename T>
+void
+DataStructures::TimingWheel<T>::spread(uint32_t list)
+{
+  uint32_t index = heads[list];
+  heads[list] = no_timer;
+  if (list != overflow)
+    occupied[list / slots_per_level][list % slots_per_level / 64] &=
+      ~(uint64_t{ 1 } << (list % 64));
+  while (index != no_timer) {
+    uint32_t next = timers[index].next;
+    link(index, list_for(timers[index].deadline));
+    index = next;
+  }
+}
@@ -0,0 +1,255 @@
+#ifndef __DATA_STRUCTURES_XOR_LINKED_LIST
+#define __DATA_STRUCTURES_XOR_LINKED_LIST
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+
+namespace DataStructures {
+
+/**
+  A doubly linked list in which each element stores its previous and
+  next addresses xored together in a single link.
+
+  Knowing either neighbour of an element gives the other, so the list
+  can be walked from either end and either end can be popped in O(1),
+  while an element is no bigger than a `LinkedList` element: the datum
+  and one pointer-sized link, so sizeof(T) + 8 bytes on 64-bit before
+  padding, where a `std::list` node needs sizeof(T) + 16.  In exchange
+  an element can't be reached from its address alone, only by walking
+  to it, and each step of a walk is an extra load and xor.
+*/
+template<typename T>
+class XorLinkedList
+{
+public:
+  static_assert(std::is_same<decltype(T{} == T{}), bool>(),
+                "value type must have `operator==(T&)` defined");
+  static_assert(std::is_same<decltype(T{} != T{}), bool>(),
+                "value type must have `operator!=(T&)` defined");
+
+private:
+  struct Element
+  {
+    T datum;
+    // the address of the previous element xor that of the next
+    uintptr_t link;
+  };
+
+  Element* first;
+  Element* last;
+  size_t number_of_elements;
+
+public:
+  /**
+    A type for iterating through the list, forward from begin() or
+    backward from rbegin().
+  */
+  class iterator
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T;
+
+  private:
+    // the element the iterator came from, needed to find the one after
+    Element* previous;
+    Element* current;
+
+  public:
+    explicit iterator(Element* start);
+    explicit iterator()
+      : previous(nullptr)
+      , current(nullptr)
+    {}
+    iterator& operator++();
+    bool operator==(iterator other) const;
+    bool operator!=(iterator other) const;
+    T operator*() const;
+  };
+
+  using reverse_iterator = iterator;
+
+  /**
+    An iterator to the start of the list.
+  */
+  iterator begin() const;
+
+  /**
+    An iterator to the terminus of the list.
+  */
+  iterator end() const;
+
+  /**
+    An iterator to the end of the list, going toward the start.
+  */
+  reverse_iterator rbegin() const;
+
+  /**
+    An iterator to before the start of the list.
+  */
+  reverse_iterator rend() const;
+
+  /**
+    Construct the list from the logical contents.
+
+    @param  contents  Those elements which make up the list.
+  */
+  XorLinkedList(std::initializer_list<T> contents);
+
+  /**
+    Construct an empty list.
+  */
+  XorLinkedList();
+
+  /**
+    Construct a copy of a list.
+  */
+  XorLinkedList(const XorLinkedList& other);
+
+  /**
+    Move the list to a new place.
+  */
+  XorLinkedList(XorLinkedList&& other) noexcept;
+
+  /**
+    Assign the list a copy of another list.
+  */
+  XorLinkedList& operator=(const XorLinkedList& other);
+
+  /**
+    Move data from another list to this list.
+  */
+  XorLinkedList& operator=(XorLinkedList&& other) noexcept;
+
+  /**
+    Destroy the list.
+  */
+  ~XorLinkedList();
+
+  /**
+    The number of elements in the list.
+  */
+  size_t size() const;
+
+  /**
+    Check if there are exactly 0 elements in the list.
+  */
+  bool empty() const;
+
+  /**
+    Check if this and that list have equal data.
+
+    @param  other   A list whose equality you're interested in
+  */
+  bool operator==(const XorLinkedList& other) const;
+
+  /**
+    Check if this and that list have inequal data.
+
+    @param  other   A list whose inequality you're interested in
+  */
+  bool operator!=(const XorLinkedList& other) const;
+
+  /**
+    The value of the first item in the list.
+
+    Should the list be empty, this method will result in undefined
+    behaviour, likely a crash.
+
+    @return The datum beginning the list
+    {
+  */
+  T& front();
+  const T& cfront() const;
+  /**}*/
+
+  /**
+    The value of the last item in the list.
+
+    Should the list be empty, this method will result in undefined
+    behaviour, likely a crash.
+
+    @return The datum terminating the list
+    {
+  */
+  T& back();
+  const T& cback() const;
+  /**}*/
+
+  /**
+    Add the given value to the beginning of the list.
+
+    @param  new_value   The datum to be added to the list
+  */
+  void push_front(const T& new_value);
+
+  /**
+    Add the given value to the end of the list.
+
+    @param  new_value   The datum to be added to the list
+  */
+  void push_back(const T& new_value);
+
+  /**
+    Remove the first item from the list and return it.
+
+    Should the list be empty, this method will result in undefined
+    behaviour, likely a crash.
+
+    @return The datum formerly at the start of the list
+  */
+  T pop_front();
+
+  /**
+    Remove the last item from the list and return it, in O(1).
+
+    Should the list be empty, this method will result in undefined
+    behaviour, likely a crash.
+
+    @return The datum that was previously the list's last
+  */
+  T pop_back();
+
+  /**
+    Remove all elements from the list.
+  */
+  void clear();
+
+  /**
+    Delete the first element equal to the given value.
+
+    @param  value   That value whose equal will be tossed out.
+
+    @return True if value had an equal to be removed, otherwise false
+  */
+  bool remove(const T& value);
+
+  /**
+    Apply the given function element-wise to the list.
+
+    @param closure  A function representing the desired mutation
+  */
+  void map(std::function<T(const T&)> closure);
+
+private:
+  /**
+    The neighbour of the element on the other side from the given one.
+  */
+  static Element* other_neighbour(const Element* element,
+                                  const Element* neighbour);
+
+  static uintptr_t address(const Element* element);
+};
+
+#include "XorLinkedList.inl"
+
+} // namespace DataStructures
+
+#endif
@@ -0,0 +1,346 @@
+// inlined in XorLinkedList.h
+
+template<typename T>
+DataStructures::XorLinkedList<T>::iterator::iterator(Element* start)
+{
+  previous = nullptr;
+  current = start;
+}
+
+template<typename T>
+typename XorLinkedList<T>::iterator&
+DataStructures::XorLinkedList<T>::iterator::operator++()
+{
+  Element* next = other_neighbour(current, previous);
+  previous = current;
+  current = next;
+  return *this;
+}
+
+template<typename T>
+bool
+DataStructures::XorLinkedList<T>::iterator::operator==(
+  const iterator other) const
+{
+  return current == other.current;
+}
+
+template<typename T>
+bool
+DataStructures::XorLinkedList<T>::iterator::operator!=(
+  const iterator other) const
+{
+  return current != other.current;
+}
+
+template<typename T>
+T
+DataStructures::XorLinkedList<T>::iterator::operator*() const
+{
+  return current->datum;
+}
+
+template<typename T>
+typename XorLinkedList<T>::iterator
+DataStructures::XorLinkedList<T>::begin() const
+{
+  return iterator{ first };
+}
+
+template<typename T>
+typename XorLinkedList<T>::iterator
+DataStructures::XorLinkedList<T>::end() const
+{
+  return iterator{};
+}
+
+template<typename T>
+typename XorLinkedList<T>::reverse_iterator
+DataStructures::XorLinkedList<T>::rbegin() const
+{
+  // walking from the last element with nothing after it is walking
+  // backward, as the link reads the same either way
+  return reverse_iterator{ last };
+}
+
+template<typename T>
+typename XorLinkedList<T>::reverse_iterator
+DataStructures::XorLinkedList<T>::rend() const
+{
+  return reverse_iterator{};
+}
+
+template<typename T>
+DataStructures::XorLinkedList<T>::XorLinkedList(
+  std::initializer_list<T> contents)
+  : XorLinkedList()
+{
+  for (const T& datum : contents)
+    push_back(datum);
+}
+
+template<typename T>
+DataStructures::XorLinkedList<T>::XorLinkedList()
+{
+  first = nullptr;
+  last = nullptr;
+  number_of_elements = 0;
+}
+
+template<typename T>
+DataStructures::XorLinkedList<T>::XorLinkedList(const XorLinkedList& other)
+  : XorLinkedList()
+{
+  *this = other;
+}
+
+template<typename T>
+XorLinkedList<T>&
+DataStructures::XorLinkedList<T>::operator=(const XorLinkedList& other)
+{
+  if (this == &other)
+    return *this;
+  clear();
+  for (auto it = other.begin(); it != other.end(); ++it)
+    push_back(*it);
+  return *this;
+}
+
+template<typename T>
+DataStructures::XorLinkedList<T>::XorLinkedList(XorLinkedList&& other) noexcept
+{
+  first = other.first;
+  last = other.last;
+  number_of_elements = other.number_of_elements;
+
+  other.first = nullptr;
+  other.last = nullptr;
+  other.number_of_elements = 0;
+}
+
+template<typename T>
+XorLinkedList<T>&
+DataStructures::XorLinkedList<T>::operator=(XorLinkedList&& other) noexcept
+{
+  if (this == &other)
+    return *this;
+
+  std::swap(first, other.first);
+  std::swap(last, other.last);
+  std::swap(number_of_elements, other.number_of_elements);
+  return *this;
+}
+
+template<typename T>
+DataStructures::XorLinkedList<T>::~XorLinkedList()
+{
+  clear();
+}
+
+template<typename T>
+size_t
+DataStructures::XorLinkedList<T>::size() const
+{
+  return number_of_elements;
+}
+
+template<typename T>
+bool
+DataStructures::XorLinkedList<T>::empty() const
+{
+  return number_of_elements == 0;
+}
+
+template<typename T>
+bool
+DataStructures::XorLinkedList<T>::operator==(const XorLinkedList& other) const
+{
+  if (other.size() != number_of_elements)
+    return false;
+
+  auto other_it = other.begin();
+  for (auto this_it = begin(); this_it != end(); ++this_it) {
+    if (*this_it != *other_it)
+      return false;
+    ++other_it;
+  }
+  return true;
+}
+
+template<typename T>
+bool
+DataStructures::XorLinkedList<T>::operator!=(const XorLinkedList& other) const
+{
+  return !operator==(other);
+}
+
+template<typename T>
+T&
+DataStructures::XorLinkedList<T>::front()
+{
+  assert(!empty());
+  return first->datum;
+}
+
+template<typename T>
+const T&
+DataStructures::XorLinkedList<T>::cfront() const
+{
+  assert(!empty());
+  return first->datum;
+}
+
+template<typename T>
+T&
+DataStructures::XorLinkedList<T>::back()
+{
+  assert(!empty());
+  return last->datum;
+}
+
+template<typename T>
+const T&
+DataStructures::XorLinkedList<T>::cback() const
+{
+  assert(!empty());
+  return last->datum;
+}
+
+template<typename T>
+void
+DataStructures::XorLinkedList<T>::push_front(const T& new_value)
+{
+  Element* new_first = new Element{ new_value, address(first) };
+  if (first == nullptr)
+    last = new_first;
+  else
+    first->link ^= address(new_first);
+  first = new_first;
+  number_of_elements += 1;
+}
+
+template<typename T>
+void
+DataStructures::XorLinkedList<T>::push_back(const T& new_value)
+{
+  Element* new_last = new Element{ new_value, address(last) };
+  if (last == nullptr)
+    first = new_last;
+  else
+    last->link ^= address(new_last);
+  last = new_last;
+  number_of_elements += 1;
+}
+
+template<typename T>
+T
+DataStructures::XorLinkedList<T>::pop_front()
+{
+  assert(!empty());
+  Element* old_first = first;
+  first = other_neighbour(old_first, nullptr);
+  if (first == nullptr)
+    last = nullptr;
+  else
+    first->link ^= address(old_first);
+  number_of_elements -= 1;
+  T old_first_datum = old_first->datum;
+  delete old_first;
+  return old_first_datum;
+}
+
+template<typename T>
+T
+DataStructures::XorLinkedList<T>::pop_back()
+{
+  assert(!empty());
+  Element* old_last = last;
+  last = other_neighbour(old_last, nullptr);
+  if (last == nullptr)
+    first = nullptr;
+  else
+    last->link ^= address(old_last);
+  number_of_elements -= 1;
+  T old_last_datum = old_last->datum;
+  delete old_last;
+  return old_last_datum;
+}
+
+template<typename T>
+void
+DataStructures::XorLinkedList<T>::clear()
+{
+  Element* previous_element = nullptr;
+  Element* current_element = first;
+  while (current_element != nullptr) {
+    Element* next_element = other_neighbour(current_element, previous_element);
+    // stepping only needs the address of the element stepped from, so
+    // each element can go as soon as it has been passed
+    delete previous_element;
+    previous_element = current_element;
+    current_element = next_element;
+  }
+  delete previous_element;
+  first = nullptr;
+  last = nullptr;
+  number_of_elements = 0;
+}
+
+template<typename T>
+bool
+DataStructures::XorLinkedList<T>::remove(const T& value)
+{
+  Element* previous_element = nullptr;
+  Element* current_element = first;
+  while (current_element != nullptr) {
+    Element* next_element = other_neighbour(current_element, previous_element);
+    if (current_element->datum == value) {
+      // each neighbour swaps the removed element for the other neighbour
+      if (previous_element == nullptr)
+        first = next_element;
+      else
+        previous_element->link ^= address(current_element) ^
+                                   address(next_element);
+      if (next_element == nullptr)
+        last = previous_element;
+      else
+        next_element->link ^= address(current_element) ^
+                               address(previous_element);
+      delete current_element;
+      number_of_elements -= 1;
+      return true;
+    }
+    previous_element = current_element;
+    current_element = next_element;
+  }
+  return false;
+}
+
+template<typename T>
+void
+DataStructures::XorLinkedList<T>::map(std::function<T(const T&)> closure)
+{
+  Element* previous_element = nullptr;
+  Element* current_element = first;
+  while (current_element != nullptr) {
+    current_element->datum = closure(current_element->datum);
+    Element* next_element = other_neighbour(current_element, previous_element);
+    previous_element = current_element;
+    current_element = next_element;
+  }
+}
+
+template<typename T>
+typename XorLinkedList<T>::Element*
+DataStructures::XorLinkedList<T>::other_neighbour(const Element* element,
+                                                  const Element* neighbour)
+{
+  return reinterpret_cast<Element*>(element->link ^ address(neighbour));
+}
+
+template<typename T>
+uintptr_t
+DataStructures::XorLinkedList<T>::address(const Element* element)
+{
+  return reinterpret_cast<uintptr_t>(element);
+}
@@ -0,0 +1,133 @@
+#include "AsyncChannel.h"
+
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace DataStructures;
+
+namespace {
+
+EventLoop::Task
+produce(AsyncChannel<int>& channel, std::vector<std::string>& log, int count)
+{
+  for (int i = 0; i < count; ++i) {
+    log.push_back("send " + std::to_string(i));
+    co_await channel.send(i);
+  }
+  channel.close();
+}
+
+EventLoop::Task
+consume(AsyncChannel<int>& channel,
+        std::vector<std::string>& log,
+        std::vector<int>& received)
+{
+  while (std::optional<int> value = co_await channel.receive()) {
+    log.push_back("receive " + std::to_string(*value));
+    received.push_back(*value);
+  }
+}
+
+} // namespace
+
+TEST(AsyncChannelTest, ReceiverGetsEverythingInOrder)
+{
+  EventLoop loop{};
+  AsyncChannel<int> channel{ loop, 4 };
+  std::vector<std::string> log{};
+  std::vector<int> received{};
+  loop.spawn(consume(channel, log, received));
+  loop.spawn(produce(channel, log, 100));
+  loop.run();
+  ASSERT_EQ(received.size(), 100);
+  for (int i = 0; i < 100; ++i)
+    ASSERT_EQ(received[i], i);
+  ASSERT_EQ(loop.unfinished(), 0);
+}
+
+TEST(AsyncChannelTest, FullChannelHoldsTheSenderBack)
+{
+  EventLoop loop{};
+  AsyncChannel<int> channel{ loop, 2 };
+  std::vector<std::string> log{};
+  std::vector<int> received{};
+  loop.spawn(produce(channel, log, 5));
+  loop.run();
+  // two values fit and the third send waits
+  std::vector<std::string> sent{ "send 0", "send 1", "send 2" };
+  ASSERT_EQ(log, sent);
+  ASSERT_EQ(channel.size(), 2);
+
+  loop.spawn(consume(channel, log, received));
+  loop.run();
+  std::vector<int> all{ 0, 1, 2, 3, 4 };
+  ASSERT_EQ(received, all);
+  ASSERT_TRUE(channel.closed());
+}
+
+TEST(AsyncChannelTest, UnbufferedChannelHandsValuesOver)
+{
+  EventLoop loop{};
+  AsyncChannel<int> channel{ loop, 0 };
+  std::vector<std::string> log{};
+  std::vector<int> received{};
+  loop.spawn(produce(channel, log, 3));
+  loop.spawn(consume(channel, log, received));
+  loop.run();
+  std::vector<int> all{ 0, 1, 2 };
+  ASSERT_EQ(received, all);
+  ASSERT_EQ(channel.size(), 0);
+}
+
+TEST(AsyncChannelTest, ClosingReleasesWaitingSendersAndReceivers)
+{
+  EventLoop loop{};
+  AsyncChannel<std::string> channel{ loop, 0 };
+  std::vector<bool> sent{};
+  std::vector<bool> received{};
+  auto sender = [](AsyncChannel<std::string>& channel,
+                   std::vector<bool>& sent) -> EventLoop::Task {
+    sent.push_back(co_await channel.send("message in a bottle"));
+  };
+  auto receiver = [](AsyncChannel<std::string>& channel,
+                     std::vector<bool>& received) -> EventLoop::Task {
+    received.push_back((co_await channel.receive()).has_value());
+  };
+
+  loop.spawn(sender(channel, sent));
+  loop.run();
+  ASSERT_TRUE(sent.empty());
+  channel.close();
+  loop.run();
+  std::vector<bool> not_sent{ false };
+  ASSERT_EQ(sent, not_sent);
+
+  loop.spawn(receiver(channel, received));
+  loop.run();
+  std::vector<bool> nothing_received{ false };
+  ASSERT_EQ(received, nothing_received);
+
+  // sends to a closed channel fail straight away
+  loop.spawn(sender(channel, sent));
+  loop.run();
+  ASSERT_EQ(sent.size(), 2);
+  ASSERT_FALSE(sent[1]);
+}
+
+TEST(AsyncChannelTest, ClosedChannelIsDrainedBeforeReceiversGetNothing)
+{
+  EventLoop loop{};
+  AsyncChannel<int> channel{ loop, 8 };
+  std::vector<std::string> log{};
+  std::vector<int> received{};
+  loop.spawn(produce(channel, log, 3));
+  loop.run();
+  ASSERT_TRUE(channel.closed());
+  loop.spawn(consume(channel, log, received));
+  loop.run();
+  std::vector<int> all{ 0, 1, 2 };
+  ASSERT_EQ(received, all);
+}
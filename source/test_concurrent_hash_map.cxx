@@ -0,0 +1,195 @@
+#include "ConcurrentHashMap.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace DataStructures;
+
+TEST(ConcurrentHashMapTest, EmptyMapIsEmpty)
+{
+  ConcurrentHashMap<int, int> empty{};
+  ASSERT_TRUE(empty.empty());
+  ASSERT_EQ(empty.size(), 0);
+  ASSERT_FALSE(empty.contains(0));
+}
+
+TEST(ConcurrentHashMapTest, FindGivesTheInsertedValue)
+{
+  ConcurrentHashMap<std::string, std::string> capitals{};
+  ASSERT_TRUE(capitals.insert("France", "Paris"));
+  ASSERT_TRUE(capitals.insert("Peru", "Lima"));
+  std::string capital;
+  ASSERT_TRUE(capitals.find("France", capital));
+  ASSERT_EQ(capital, "Paris");
+  ASSERT_TRUE(capitals.find("Peru", capital));
+  ASSERT_EQ(capital, "Lima");
+  ASSERT_FALSE(capitals.find("Atlantis", capital));
+  ASSERT_EQ(capitals.size(), 2);
+}
+
+TEST(ConcurrentHashMapTest, InsertReplacesTheValueOfAnExistingKey)
+{
+  ConcurrentHashMap<std::string, int> scores{};
+  ASSERT_TRUE(scores.insert("Ada", 10));
+  ASSERT_FALSE(scores.insert("Ada", 12));
+  int score = 0;
+  ASSERT_TRUE(scores.find("Ada", score));
+  ASSERT_EQ(score, 12);
+  ASSERT_EQ(scores.size(), 1);
+}
+
+TEST(ConcurrentHashMapTest, EraseForgetsTheKey)
+{
+  ConcurrentHashMap<int, std::string> numerals{};
+  numerals.insert(1, "I");
+  numerals.insert(5, "V");
+  numerals.insert(10, "X");
+  ASSERT_TRUE(numerals.erase(5));
+  ASSERT_FALSE(numerals.erase(5));
+  ASSERT_FALSE(numerals.contains(5));
+  ASSERT_TRUE(numerals.contains(1));
+  ASSERT_TRUE(numerals.contains(10));
+  ASSERT_EQ(numerals.size(), 2);
+}
+
+TEST(ConcurrentHashMapTest, CollidingKeysShareABucket)
+{
+  struct Constant
+  {
+    size_t operator()(int) const { return 7; }
+  };
+  ConcurrentHashMap<int, int, Constant> collisions{};
+  for (int i = 0; i < 10; ++i)
+    collisions.insert(i, i * i);
+  ASSERT_TRUE(collisions.erase(4));
+  int square = 0;
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_EQ(collisions.find(i, square), i != 4);
+    if (i != 4) {
+      ASSERT_EQ(square, i * i);
+    }
+  }
+}
+
+TEST(ConcurrentHashMapTest, GrowingKeepsEveryElement)
+{
+  ConcurrentHashMap<int, int> squares{};
+  size_t initial_bucket_count = squares.bucket_count();
+  for (int i = 0; i < 5000; ++i) {
+    squares.insert(i, i * i);
+    // look every element up midway through the resizes too
+    if (i % 97 == 0) {
+      for (int j = 0; j <= i; ++j)
+        ASSERT_TRUE(squares.contains(j));
+    }
+  }
+  ASSERT_GT(squares.bucket_count(), initial_bucket_count);
+  int square = 0;
+  for (int i = 0; i < 5000; ++i) {
+    ASSERT_TRUE(squares.find(i, square));
+    ASSERT_EQ(square, i * i);
+  }
+}
+
+TEST(ConcurrentHashMapTest, ForEachVisitsEveryElementOnce)
+{
+  ConcurrentHashMap<int, int> doubles{};
+  std::map<int, int> expected{};
+  for (int i = 0; i < 300; ++i) {
+    doubles.insert(i, 2 * i);
+    expected[i] = 2 * i;
+  }
+  std::map<int, int> visited{};
+  doubles.for_each([&visited](const int& key, const int& value) {
+    ASSERT_EQ(visited.count(key), 0);
+    visited[key] = value;
+  });
+  ASSERT_EQ(visited, expected);
+}
+
+TEST(ConcurrentHashMapTest, ConcurrentReadersAndWritersAgree)
+{
+  const int number_of_writers = 4;
+  const int keys_per_writer = 2000;
+  ConcurrentHashMap<int, int> shared{};
+  std::atomic<bool> done{ false };
+
+  std::thread reader{ [&shared, &done]() {
+    int value = 0;
+    while (!done)
+      for (int key = 0; key < number_of_writers * keys_per_writer; key += 7) {
+        if (shared.find(key, value)) {
+          ASSERT_EQ(value, -key);
+        }
+      }
+  } };
+  std::vector<std::thread> writers{};
+  for (int t = 0; t < number_of_writers; ++t) {
+    writers.emplace_back([&shared, t]() {
+      for (int i = 0; i < keys_per_writer; ++i) {
+        int key = i * number_of_writers + t;
+        shared.insert(key, -key);
+        if (i % 3 == 0)
+          shared.erase(key);
+      }
+    });
+  }
+  for (auto& writer : writers)
+    writer.join();
+  done = true;
+  reader.join();
+
+  int erased = 0;
+  for (int key = 0; key < number_of_writers * keys_per_writer; ++key) {
+    bool should_be_erased = (key / number_of_writers) % 3 == 0;
+    ASSERT_EQ(shared.contains(key), !should_be_erased);
+    erased += should_be_erased;
+  }
+  ASSERT_EQ(shared.size(), number_of_writers * keys_per_writer - erased);
+}
+
+TEST(ConcurrentHashMapTest, ReadersNeverSeeFreedElements)
+{
+  // few keys, so readers keep landing on elements that writers are
+  // replacing and erasing; the values are too long to be stored inline,
+  // so copying out of a freed element reads freed memory, which the
+  // sanitizers report
+  const int number_of_keys = 8;
+  ConcurrentHashMap<int, std::string> shared{};
+  std::atomic<bool> done{ false };
+  std::atomic<int> bad_reads{ 0 };
+
+  std::vector<std::thread> readers{};
+  for (int r = 0; r < 2; ++r)
+    readers.emplace_back([&]() {
+      std::string value{};
+      while (!done)
+        for (int key = 0; key < number_of_keys; ++key)
+          if (shared.find(key, value) &&
+              value.rfind("a value long enough for the heap ", 0) != 0)
+            bad_reads.fetch_add(1);
+    });
+  std::vector<std::thread> writers{};
+  for (int w = 0; w < 2; ++w)
+    writers.emplace_back([&shared, w]() {
+      for (int round = 0; round < 20000; ++round) {
+        int key = (round + w) % number_of_keys;
+        shared.insert(key,
+                      "a value long enough for the heap " +
+                        std::to_string(round));
+        if (round % 3 == w)
+          shared.erase(key);
+      }
+    });
+  for (std::thread& writer : writers)
+    writer.join();
+  done = true;
+  for (std::thread& reader : readers)
+    reader.join();
+  ASSERT_EQ(bad_reads.load(), 0);
+}
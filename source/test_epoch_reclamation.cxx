@@ -0,0 +1,113 @@
+#include "EpochReclamation.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+using namespace DataStructures;
+
+namespace {
+
+struct Tracked
+{
+  static std::atomic<int> alive;
+
+  Tracked() { alive += 1; }
+  ~Tracked() { alive -= 1; }
+};
+
+std::atomic<int> Tracked::alive{ 0 };
+
+} // namespace
+
+TEST(EpochReclamationTest, SynchronizeFreesEverythingRetired)
+{
+  for (int i = 0; i < 10; ++i)
+    EpochReclamation::retire(new Tracked{});
+  ASSERT_EQ(Tracked::alive, 10);
+  EpochReclamation::synchronize();
+  ASSERT_EQ(Tracked::alive, 0);
+  ASSERT_EQ(EpochReclamation::pending(), 0);
+}
+
+TEST(EpochReclamationTest, GarbageOutlivesAGuardThatCouldSeeIt)
+{
+  std::atomic<bool> entered{ false };
+  std::atomic<bool> retired{ false };
+  std::thread reader{ [&entered, &retired]() {
+    EpochReclamation::Guard guard{};
+    entered = true;
+    while (!retired)
+      std::this_thread::yield();
+    // the retired object is still alive as long as this guard is held
+    ASSERT_EQ(Tracked::alive, 1);
+  } };
+
+  while (!entered)
+    std::this_thread::yield();
+  EpochReclamation::retire(new Tracked{});
+  for (size_t i = 0; i < 4 * EpochReclamation::collection_threshold; ++i)
+    EpochReclamation::retire(new int{});
+  ASSERT_EQ(Tracked::alive, 1);
+  retired = true;
+  reader.join();
+  EpochReclamation::synchronize();
+  ASSERT_EQ(Tracked::alive, 0);
+}
+
+TEST(EpochReclamationTest, GuardsNest)
+{
+  {
+    EpochReclamation::Guard outer{};
+    {
+      EpochReclamation::Guard inner{};
+    }
+    EpochReclamation::retire(new Tracked{});
+  }
+  EpochReclamation::synchronize();
+  ASSERT_EQ(Tracked::alive, 0);
+}
+
+TEST(EpochReclamationTest, ThreadsHandOverWhatTheyRetiredWhenTheyEnd)
+{
+  EpochReclamation::synchronize();
+  std::thread writers[4];
+  for (std::thread& writer : writers)
+    writer = std::thread{ []() {
+      // fewer than a batch, so they are only handed over at the end
+      for (int i = 0; i < 10; ++i)
+        EpochReclamation::retire(new Tracked{});
+    } };
+  for (std::thread& writer : writers)
+    writer.join();
+  ASSERT_EQ(EpochReclamation::pending(), 40);
+  EpochReclamation::synchronize();
+  ASSERT_EQ(Tracked::alive, 0);
+  ASSERT_EQ(EpochReclamation::pending(), 0);
+}
+
+TEST(EpochReclamationTest, RarelyRetiringThreadsHandOverOnceAnEpochHasPassed)
+{
+  EpochReclamation::synchronize();
+  std::atomic<int> step{ 0 };
+  std::thread writer{ [&step]() {
+    EpochReclamation::retire(new Tracked{});
+    step = 1;
+    while (step != 2)
+      std::this_thread::yield();
+    // the first object is two epochs old by now, so this frees it
+    EpochReclamation::retire(new int{});
+    ASSERT_EQ(Tracked::alive, 0);
+    ASSERT_EQ(EpochReclamation::pending(), 1);
+    EpochReclamation::reclaim();
+  } };
+
+  while (step != 1)
+    std::this_thread::yield();
+  EpochReclamation::reclaim();
+  ASSERT_EQ(Tracked::alive, 1);
+  step = 2;
+  writer.join();
+  ASSERT_EQ(EpochReclamation::pending(), 0);
+}
@@ -0,0 +1,71 @@
+#include "EventLoop.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace DataStructures;
+
+namespace {
+
+EventLoop::Task
+count_off(EventLoop& loop, std::vector<std::string>& log, std::string name)
+{
+  for (int i = 0; i < 3; ++i) {
+    log.push_back(name + std::to_string(i));
+    co_await loop.yield();
+  }
+}
+
+} // namespace
+
+TEST(EventLoopTest, NewLoopIsIdle)
+{
+  EventLoop loop{};
+  ASSERT_TRUE(loop.idle());
+  ASSERT_EQ(loop.run(), 0);
+}
+
+TEST(EventLoopTest, SpawnedTasksRunWhenTheLoopRuns)
+{
+  EventLoop loop{};
+  std::vector<std::string> log{};
+  loop.spawn(count_off(loop, log, "a"));
+  ASSERT_TRUE(log.empty());
+  ASSERT_EQ(loop.unfinished(), 1);
+  loop.run();
+  std::vector<std::string> expected{ "a0", "a1", "a2" };
+  ASSERT_EQ(log, expected);
+  ASSERT_EQ(loop.unfinished(), 0);
+}
+
+TEST(EventLoopTest, YieldingTasksTakeTurns)
+{
+  EventLoop loop{};
+  std::vector<std::string> log{};
+  loop.spawn(count_off(loop, log, "a"));
+  loop.spawn(count_off(loop, log, "b"));
+  loop.run();
+  std::vector<std::string> expected{ "a0", "b0", "a1", "b1", "a2", "b2" };
+  ASSERT_EQ(log, expected);
+}
+
+TEST(EventLoopTest, UnspawnedAndUnfinishedTasksAreDestroyed)
+{
+  std::vector<std::string> log{};
+  auto stalls = [](std::vector<std::string>& log) -> EventLoop::Task {
+    log.push_back("waiting");
+    co_await std::suspend_always{};
+    log.push_back("never");
+  };
+  {
+    EventLoop loop{};
+    EventLoop::Task never_spawned = count_off(loop, log, "x");
+    loop.spawn(stalls(log));
+    loop.run();
+    ASSERT_EQ(loop.unfinished(), 1);
+  }
+  std::vector<std::string> expected{ "waiting" };
+  ASSERT_EQ(log, expected);
+}
@@ -0,0 +1,65 @@
+#include "Generator.h"
+#include "LinkedList.h"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace DataStructures;
+
+namespace {
+
+Generator<int>
+naturals()
+{
+  for (int i = 0;; ++i)
+    co_yield i;
+}
+
+Generator<int>
+fails_after_one()
+{
+  co_yield 1;
+  throw std::runtime_error{ "out of ideas" };
+}
+
+} // namespace
+
+TEST(GeneratorTest, StreamYieldsEveryElementOfTheList)
+{
+  LinkedList<std::string> colours{ "red", "orange", "yellow", "green" };
+  std::vector<std::string> streamed{};
+  for (const std::string& colour : stream(colours))
+    streamed.push_back(colour);
+  std::vector<std::string> expected{ "red", "orange", "yellow", "green" };
+  ASSERT_EQ(streamed, expected);
+}
+
+TEST(GeneratorTest, StreamingAnEmptyListYieldsNothing)
+{
+  LinkedList<int> empty{};
+  Generator<int> nothing = stream(empty);
+  ASSERT_TRUE(nothing.begin() == nothing.end());
+}
+
+TEST(GeneratorTest, ValuesAreOnlyMadeWhenAskedFor)
+{
+  Generator<int> infinite = naturals();
+  int sum = 0;
+  for (int natural : infinite) {
+    if (natural > 10)
+      break;
+    sum += natural;
+  }
+  ASSERT_EQ(sum, 55);
+}
+
+TEST(GeneratorTest, ExceptionsReachTheConsumer)
+{
+  Generator<int> failing = fails_after_one();
+  auto it = failing.begin();
+  ASSERT_EQ(*it, 1);
+  ASSERT_THROW(++it, std::runtime_error);
+}
@@ -3,7 +3,10 @@
 #include <gtest/gtest.h>
 
 #include <string>
+#include <thread>
 #include <type_traits>
+#include <unordered_set>
+#include <vector>
 
 using namespace DataStructures;
 
@@ -455,3 +458,359 @@ TEST(LinkedListTest, MoveAnObjectToItself)
   months_fi_0 = std::move(months_fi_0);
   ASSERT_EQ(months_fi_0, months_fi_1);
 }
+
+TEST(LinkedListTest, BackIsKeptUpByEveryModifier)
+{
+  LinkedList<int> list{};
+  list.push_front(1);
+  ASSERT_EQ(list.back(), 1);
+  list.pop_back();
+  list.push_back(2);
+  ASSERT_EQ(list.front(), 2);
+  list.push_back(3);
+  ASSERT_TRUE(list.remove(3));
+  ASSERT_EQ(list.back(), 2);
+  list.pop_front();
+  list.push_back(4);
+  ASSERT_EQ(list.front(), 4);
+
+  LinkedList<int> empty{};
+  list = empty;
+  list.push_back(5);
+  ASSERT_EQ(list.front(), 5);
+  ASSERT_EQ(list.back(), 5);
+}
+
+TEST(LinkedListTest, AtGivesTheValueAtAPosition)
+{
+  LinkedList<std::string> planets{ "Mercury", "Venus", "Earth", "Mars",
+                                   "Jupiter", "Saturn", "Uranus", "Neptune" };
+  ASSERT_EQ(planets.at(0), "Mercury");
+  ASSERT_EQ(planets.at(3), "Mars");
+  ASSERT_EQ(planets.at(4), "Jupiter");
+  ASSERT_EQ(planets.at(2), "Earth");
+  ASSERT_EQ(planets.at(7), "Neptune");
+  planets.at(2) = "Terra";
+  const LinkedList<std::string>& const_planets = planets;
+  ASSERT_EQ(const_planets.at(2), "Terra");
+  ASSERT_EQ(const_planets.at(5), "Saturn");
+  // list.at(list.size()) is undefined
+}
+
+TEST(LinkedListTest, InsertAtPutsTheValueAtThePosition)
+{
+  LinkedList<int> odds{ 1, 3, 5 };
+  odds.insert_at(1, 2);
+  odds.insert_at(3, 4);
+  odds.insert_at(0, 0);
+  odds.insert_at(6, 6);
+  LinkedList<int> naturals{ 0, 1, 2, 3, 4, 5, 6 };
+  ASSERT_EQ(odds, naturals);
+  ASSERT_EQ(odds.back(), 6);
+  ASSERT_EQ(odds.size(), 7);
+
+  LinkedList<int> empty{};
+  empty.insert_at(0, 42);
+  ASSERT_EQ(empty.front(), 42);
+  ASSERT_EQ(empty.back(), 42);
+}
+
+TEST(LinkedListTest, EraseAtRemovesAndReturnsTheValueAtThePosition)
+{
+  LinkedList<int> naturals{ 0, 1, 2, 3, 4, 5, 6 };
+  ASSERT_EQ(naturals.erase_at(6), 6);
+  ASSERT_EQ(naturals.back(), 5);
+  ASSERT_EQ(naturals.erase_at(1), 1);
+  ASSERT_EQ(naturals.erase_at(2), 3);
+  ASSERT_EQ(naturals.erase_at(0), 0);
+  LinkedList<int> left{ 2, 4, 5 };
+  ASSERT_EQ(naturals, left);
+}
+
+TEST(LinkedListTest, InsertAfterPutsTheValueAfterTheIterator)
+{
+  LinkedList<std::string> sandwich{ "bread", "bread" };
+  auto cheese = sandwich.insert_after(sandwich.begin(), "cheese");
+  ASSERT_EQ(*cheese, "cheese");
+  sandwich.insert_after(cheese, "tomato");
+  LinkedList<std::string> made{ "bread", "cheese", "tomato", "bread" };
+  ASSERT_EQ(sandwich, made);
+
+  auto top = sandwich.begin();
+  for (int i = 0; i < 3; ++i)
+    ++top;
+  sandwich.insert_after(top, "toothpick");
+  ASSERT_EQ(sandwich.back(), "toothpick");
+}
+
+TEST(LinkedListTest, PositionsStayRightAcrossOtherModifiers)
+{
+  LinkedList<int> list{ 10, 20, 30, 40, 50 };
+  ASSERT_EQ(list.at(2), 30);
+  list.push_front(0);
+  ASSERT_EQ(list.at(3), 30);
+  list.pop_front();
+  ASSERT_EQ(list.at(2), 30);
+  list.pop_front();
+  ASSERT_EQ(list.at(1), 30);
+  ASSERT_TRUE(list.remove(20));
+  ASSERT_EQ(list.at(0), 30);
+  ASSERT_TRUE(list.remove(30));
+  ASSERT_EQ(list.at(0), 40);
+  ASSERT_EQ(list.at(1), 50);
+  list.pop_back();
+  list.push_back(60);
+  ASSERT_EQ(list.at(1), 60);
+  list.insert_after(list.begin(), 45);
+  ASSERT_EQ(list.at(1), 45);
+  ASSERT_EQ(list.at(2), 60);
+  list.clear();
+  list.push_back(70);
+  ASSERT_EQ(list.at(0), 70);
+
+  LinkedList<int> moved{ 1, 2, 3 };
+  ASSERT_EQ(moved.at(1), 2);
+  LinkedList<int> other{ 4, 5, 6 };
+  ASSERT_EQ(other.at(2), 6);
+  moved = std::move(other);
+  ASSERT_EQ(moved.at(1), 5);
+  ASSERT_EQ(other.at(0), 1);
+}
+
+TEST(LinkedListTest, SequentialPositionalAccessVisitsEveryElement)
+{
+  LinkedList<int> list{};
+  for (int i = 0; i < 1000; ++i)
+    list.insert_at(i, i);
+  for (int i = 0; i < 1000; ++i)
+    ASSERT_EQ(list.at(i), i);
+  for (int i = 0; i < 500; ++i)
+    ASSERT_EQ(list.erase_at(i), 2 * i);
+  ASSERT_EQ(list.size(), 500);
+  ASSERT_EQ(list.back(), 999);
+}
+
+TEST(LinkedListTest, KeptHashMatchesTheHashOfTheSameData)
+{
+  LinkedList<int, RollingContentHash> kept{ 3, 1, 4 };
+  LinkedList<int> walked{ 3, 1, 4 };
+  auto check = [&]() { ASSERT_EQ(kept.hash(), walked.hash()); };
+  check();
+  kept.push_front(1);
+  walked.push_front(1);
+  check();
+  kept.push_back(5);
+  walked.push_back(5);
+  check();
+  kept.push_back(9);
+  walked.push_back(9);
+  check();
+  ASSERT_EQ(kept.pop_front(), walked.pop_front());
+  check();
+  ASSERT_EQ(kept.pop_back(), walked.pop_back());
+  check();
+  ASSERT_TRUE(kept.remove(4));
+  ASSERT_TRUE(walked.remove(4));
+  check();
+  ASSERT_FALSE(kept.remove(2));
+  check();
+  kept.map([](const int& x) { return x * 2; });
+  walked.map([](const int& x) { return x * 2; });
+  check();
+  kept.insert_at(1, 7);
+  walked.insert_at(1, 7);
+  check();
+  ASSERT_EQ(kept.erase_at(2), walked.erase_at(2));
+  check();
+  kept.insert_after(kept.begin(), 8);
+  walked.insert_after(walked.begin(), 8);
+  check();
+  while (!kept.empty()) {
+    kept.pop_back();
+    walked.pop_back();
+    check();
+  }
+  LinkedList<int, RollingContentHash> empty{};
+  ASSERT_EQ(kept.hash(), empty.hash());
+}
+
+TEST(LinkedListTest, HashDependsOnOrder)
+{
+  LinkedList<int, RollingContentHash> forwards{ 1, 2, 3 };
+  LinkedList<int, RollingContentHash> backwards{ 3, 2, 1 };
+  ASSERT_NE(forwards.hash(), backwards.hash());
+  ASSERT_NE(forwards, backwards);
+  backwards.push_back(backwards.pop_front());
+  backwards.push_front(backwards.pop_back());
+  backwards.push_back(backwards.pop_front());
+  backwards.push_back(backwards.pop_front());
+  LinkedList<int, RollingContentHash> shuffled{ 1, 3, 2 };
+  ASSERT_EQ(backwards, shuffled);
+  ASSERT_EQ(backwards.hash(), shuffled.hash());
+}
+
+TEST(LinkedListTest, WritesThroughReferencesChangeTheHash)
+{
+  LinkedList<std::string, RollingContentHash> pets{ "cat", "dog", "emu" };
+  LinkedList<std::string, RollingContentHash> zoo{ "cat", "dog", "gnu" };
+  ASSERT_NE(pets, zoo);
+  pets.back() = "gnu";
+  ASSERT_EQ(pets, zoo);
+  pets.front() = "cow";
+  pets.at(1) = "pig";
+  LinkedList<std::string, RollingContentHash> farm{ "cow", "pig", "gnu" };
+  ASSERT_EQ(pets, farm);
+  ASSERT_EQ(pets.hash(), farm.hash());
+}
+
+TEST(LinkedListTest, ConstListsCanBeReadFromManyThreads)
+{
+  LinkedList<int, RollingContentHash> squares{};
+  LinkedList<int> walked{};
+  for (int i = 0; i < 1000; ++i) {
+    squares.push_back(i * i);
+    walked.push_back(i * i);
+  }
+  // stale, so every const hash() has to walk the list
+  squares.front() = 0;
+  size_t expected = walked.hash();
+
+  const LinkedList<int, RollingContentHash>& shared = squares;
+  std::thread readers[4];
+  for (int reader = 0; reader < 4; ++reader)
+    readers[reader] = std::thread{ [&shared, expected, reader]() {
+      for (int i = reader; i < 1000; i += 7)
+        ASSERT_EQ(shared.at(i), i * i);
+      ASSERT_EQ(shared.hash(), expected);
+    } };
+  for (std::thread& reader : readers)
+    reader.join();
+  ASSERT_EQ(squares.hash(), expected);
+}
+
+TEST(LinkedListTest, CopiedAndMovedListsKeepTheirHash)
+{
+  LinkedList<int, RollingContentHash> primes{ 2, 3, 5, 7 };
+  LinkedList<int, RollingContentHash> copy{ primes };
+  ASSERT_EQ(copy.hash(), primes.hash());
+  copy.push_back(11);
+  ASSERT_NE(copy, primes);
+  LinkedList<int, RollingContentHash> moved{ std::move(copy) };
+  LinkedList<int> expected{ 2, 3, 5, 7, 11 };
+  ASSERT_EQ(moved.hash(), expected.hash());
+  ASSERT_EQ(copy.hash(), LinkedList<int>{}.hash());
+  primes = moved;
+  ASSERT_EQ(primes, moved);
+  moved.clear();
+  ASSERT_EQ(moved.hash(), LinkedList<int>{}.hash());
+}
+
+TEST(LinkedListTest, ListsCanBeKeysOfUnorderedContainers)
+{
+  std::unordered_set<LinkedList<int, RollingContentHash>> seen{};
+  seen.insert(LinkedList<int, RollingContentHash>{ 1, 2 });
+  seen.insert(LinkedList<int, RollingContentHash>{ 2, 1 });
+  seen.insert(LinkedList<int, RollingContentHash>{ 1, 2 });
+  ASSERT_EQ(seen.size(), 2);
+
+  std::unordered_set<LinkedList<int>> unkept{};
+  unkept.insert(LinkedList<int>{ 1 });
+  unkept.insert(LinkedList<int>{ 1 });
+  ASSERT_EQ(unkept.size(), 1);
+  ASSERT_EQ(std::hash<LinkedList<int>>{}(LinkedList<int>{ 4, 2 }),
+            (LinkedList<int, RollingContentHash>{ 4, 2 }.hash()));
+}
+
+TEST(LinkedListTest, ParallelCopiesMatchTheOriginal)
+{
+  LinkedList<int> countdown{};
+  for (int i = 1000; i > 0; --i)
+    countdown.push_back(i);
+  for (size_t threads : { 0, 1, 3, 8, 2000 }) {
+    LinkedList<int> copy{ countdown, threads };
+    ASSERT_EQ(copy, countdown);
+    ASSERT_EQ(copy.size(), 1000);
+    ASSERT_EQ(copy.at(999), 1);
+    copy.push_back(0);
+    ASSERT_EQ(copy.cback(), 0);
+    ASSERT_EQ(copy.at(999), 1);
+  }
+
+  LinkedList<int> empty{};
+  LinkedList<int> empty_copy{ empty, 4 };
+  ASSERT_TRUE(empty_copy.empty());
+  empty_copy.push_front(1);
+  ASSERT_EQ(empty_copy.cback(), 1);
+}
+
+TEST(LinkedListTest, ParallelConstructionKeepsTheRangeInOrder)
+{
+  std::vector<std::string> words{ "sator", "arepo", "tenet", "opera",
+                                  "rotas" };
+  LinkedList<std::string> square{ words.begin(), words.end(), 2 };
+  ASSERT_EQ(square,
+            (LinkedList<std::string>{
+              "sator", "arepo", "tenet", "opera", "rotas" }));
+  ASSERT_EQ(square.cback(), "rotas");
+
+  std::vector<int> numbers(10007);
+  for (size_t i = 0; i < numbers.size(); ++i)
+    numbers[i] = static_cast<int>(i);
+  LinkedList<int, RollingContentHash> kept{ numbers.begin(),
+                                            numbers.end(),
+                                            7 };
+  LinkedList<int, RollingContentHash> serial{};
+  for (int number : numbers)
+    serial.push_back(number);
+  ASSERT_EQ(kept.hash(), serial.hash());
+  ASSERT_EQ(kept, serial);
+}
+
+TEST(LinkedListTest, PopFrontNMovesOutARunInOrder)
+{
+  LinkedList<std::string> queue{ "eeny", "meeny", "miny", "moe" };
+  std::vector<std::string> popped{};
+  ASSERT_EQ(queue.pop_front_n(3, std::back_inserter(popped)), 3);
+  ASSERT_EQ(popped, (std::vector<std::string>{ "eeny", "meeny", "miny" }));
+  ASSERT_EQ(queue, LinkedList<std::string>{ "moe" });
+  ASSERT_EQ(queue.pop_front_n(10, std::back_inserter(popped)), 1);
+  ASSERT_EQ(popped.back(), "moe");
+  ASSERT_TRUE(queue.empty());
+  ASSERT_EQ(queue.pop_front_n(1, std::back_inserter(popped)), 0);
+  queue.push_back("catch");
+  ASSERT_EQ(queue.cfront(), "catch");
+  ASSERT_EQ(queue.cback(), "catch");
+}
+
+TEST(LinkedListTest, DrainEmptiesTheList)
+{
+  LinkedList<int, RollingContentHash> queue{ 4, 8, 15, 16, 23, 42 };
+  int drained[6] = {};
+  ASSERT_EQ(queue.drain(drained), 6);
+  ASSERT_EQ(drained[0], 4);
+  ASSERT_EQ(drained[5], 42);
+  ASSERT_TRUE(queue.empty());
+  ASSERT_EQ(queue.hash(), LinkedList<int>{}.hash());
+  ASSERT_EQ(queue.drain(drained), 0);
+  queue.push_back(1);
+  ASSERT_EQ(queue, (LinkedList<int, RollingContentHash>{ 1 }));
+}
+
+TEST(LinkedListTest, TakeFrontSplitsTheList)
+{
+  LinkedList<int, RollingContentHash> numbers{ 1, 2, 3, 4, 5 };
+  ASSERT_EQ(numbers.at(3), 4);
+  LinkedList<int, RollingContentHash> taken = numbers.take_front(2);
+  ASSERT_EQ(taken, (LinkedList<int, RollingContentHash>{ 1, 2 }));
+  ASSERT_EQ(numbers, (LinkedList<int, RollingContentHash>{ 3, 4, 5 }));
+  ASSERT_EQ(taken.hash(), (LinkedList<int>{ 1, 2 }.hash()));
+  ASSERT_EQ(numbers.hash(), (LinkedList<int>{ 3, 4, 5 }.hash()));
+  ASSERT_EQ(numbers.at(1), 4);
+  taken.push_back(6);
+  ASSERT_EQ(taken.cback(), 6);
+
+  LinkedList<int, RollingContentHash> rest = numbers.take_front(100);
+  ASSERT_TRUE(numbers.empty());
+  ASSERT_EQ(rest.size(), 3);
+  ASSERT_TRUE(numbers.take_front(1).empty());
+}
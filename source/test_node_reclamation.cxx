@@ -0,0 +1,106 @@
+#include "LinkedList.h"
+#include "NodeReclamation.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+using namespace DataStructures;
+
+namespace {
+
+std::atomic<int> destroyed{ 0 };
+
+// counts its destructions, apart from those of temporaries
+struct Tracked
+{
+  int value = 0;
+  bool counted = false;
+
+  Tracked() = default;
+  Tracked(int value)
+    : value(value)
+    , counted(true)
+  {}
+  Tracked(const Tracked& other) = default;
+  Tracked& operator=(const Tracked& other) = default;
+  ~Tracked()
+  {
+    if (counted)
+      destroyed.fetch_add(1);
+  }
+
+  bool operator==(const Tracked& other) const { return value == other.value; }
+  bool operator!=(const Tracked& other) const { return value != other.value; }
+};
+
+using DeferredList = LinkedList<Tracked, NoContentHash, BackgroundReclamation>;
+
+DeferredList
+counted_list(int length)
+{
+  DeferredList list{};
+  for (int i = 0; i < length; ++i)
+    list.push_back(Tracked{ i });
+  return list;
+}
+
+} // namespace
+
+TEST(NodeReclamationTest, ClearedListIsEmptyAtOnce)
+{
+  DeferredList list = counted_list(10000);
+  list.clear();
+  ASSERT_TRUE(list.empty());
+  list.push_back(Tracked{ 1 });
+  ASSERT_EQ(list.front().value, 1);
+  BackgroundReclamation::flush();
+}
+
+TEST(NodeReclamationTest, FlushWaitsForEveryElementToBeFreed)
+{
+  BackgroundReclamation::flush();
+  destroyed.store(0);
+  {
+    DeferredList first = counted_list(20000);
+    DeferredList second = counted_list(30000);
+    first.clear();
+    second = counted_list(5);
+  }
+  BackgroundReclamation::flush();
+  ASSERT_EQ(BackgroundReclamation::outstanding(), 0);
+  // each element once, plus the temporaries pushed and returned
+  ASSERT_GE(destroyed.load(), 50005);
+}
+
+TEST(NodeReclamationTest, ListsOverTheLimitAreFreedByTheCaller)
+{
+  BackgroundReclamation::flush();
+  BackgroundReclamation::set_limit(100);
+  DeferredList small = counted_list(50);
+  DeferredList large = counted_list(1000);
+  small.clear();
+  ASSERT_LE(BackgroundReclamation::outstanding(), 50);
+  large.clear();
+  ASSERT_LE(BackgroundReclamation::outstanding(), 100);
+  BackgroundReclamation::set_limit(BackgroundReclamation::default_limit);
+  BackgroundReclamation::flush();
+  ASSERT_EQ(BackgroundReclamation::outstanding(), 0);
+}
+
+TEST(NodeReclamationTest, ListsDroppedOnManyThreadsAreAllFreed)
+{
+  std::thread droppers[4];
+  for (std::thread& dropper : droppers)
+    dropper = std::thread{ []() {
+      for (int round = 0; round < 20; ++round) {
+        DeferredList list = counted_list(1000);
+        list.pop_front();
+      }
+    } };
+  for (std::thread& dropper : droppers)
+    dropper.join();
+  BackgroundReclamation::flush();
+  ASSERT_EQ(BackgroundReclamation::outstanding(), 0);
+}
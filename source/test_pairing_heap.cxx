@@ -0,0 +1,126 @@
+#include "PairingHeap.h"
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace DataStructures;
+
+TEST(PairingHeapTest, EmptyHeapIsEmpty)
+{
+  PairingHeap<int> empty{};
+  ASSERT_TRUE(empty.empty());
+  ASSERT_EQ(empty.size(), 0);
+}
+
+TEST(PairingHeapTest, PopGivesElementsInOrder)
+{
+  PairingHeap<int> digits_of_pi{ 3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5 };
+  std::vector<int> sorted{ 1, 1, 2, 3, 3, 4, 5, 5, 5, 6, 9 };
+  std::vector<int> popped{};
+  while (!digits_of_pi.empty())
+    popped.push_back(digits_of_pi.pop());
+  ASSERT_EQ(popped, sorted);
+  // empty.pop() is undefined
+}
+
+TEST(PairingHeapTest, TopIsTheFirstUnderTheComparison)
+{
+  PairingHeap<std::string, std::greater<std::string>> words{ "apple",
+                                                             "zebra",
+                                                             "mango" };
+  ASSERT_EQ(words.top(), "zebra");
+  words.push("zucchini");
+  ASSERT_EQ(words.top(), "zucchini");
+  ASSERT_EQ(words.size(), 4);
+}
+
+TEST(PairingHeapTest, DecreaseKeyMovesTheElementUp)
+{
+  PairingHeap<int> jobs{};
+  std::vector<PairingHeap<int>::handle> handles{};
+  for (int priority = 10; priority < 20; ++priority)
+    handles.push_back(jobs.push(priority));
+  jobs.pop();
+  jobs.decrease_key(handles[7], 3);
+  ASSERT_EQ(jobs.top(), 3);
+  ASSERT_EQ(*handles[7], 3);
+  jobs.decrease_key(handles[4], 5);
+  jobs.decrease_key(handles[9], 4);
+  ASSERT_EQ(jobs.pop(), 3);
+  ASSERT_EQ(jobs.pop(), 4);
+  ASSERT_EQ(jobs.pop(), 5);
+  ASSERT_EQ(jobs.pop(), 11);
+  ASSERT_EQ(jobs.size(), 5);
+}
+
+TEST(PairingHeapTest, EraseRemovesAnyElement)
+{
+  PairingHeap<int> heap{};
+  std::vector<PairingHeap<int>::handle> handles{};
+  for (int i = 0; i < 20; ++i)
+    handles.push_back(heap.push(i));
+  heap.pop();
+  ASSERT_EQ(heap.erase(handles[10]), 10);
+  ASSERT_EQ(heap.erase(handles[1]), 1);
+  ASSERT_EQ(heap.erase(handles[19]), 19);
+  std::vector<int> left{};
+  while (!heap.empty())
+    left.push_back(heap.pop());
+  std::vector<int> expected{ 2, 3, 4, 5, 6, 7, 8, 9, 11, 12, 13, 14, 15, 16, 17, 18 };
+  ASSERT_EQ(left, expected);
+}
+
+TEST(PairingHeapTest, MeldTakesEveryElementOfTheOther)
+{
+  PairingHeap<int> evens{ 8, 2, 6, 4 };
+  PairingHeap<int> odds{};
+  auto seven = odds.push(7);
+  odds.push(1);
+  odds.push(5);
+  evens.meld(odds);
+  ASSERT_TRUE(odds.empty());
+  ASSERT_EQ(evens.size(), 7);
+  evens.decrease_key(seven, 0);
+  std::vector<int> popped{};
+  while (!evens.empty())
+    popped.push_back(evens.pop());
+  std::vector<int> expected{ 0, 1, 2, 4, 5, 6, 8 };
+  ASSERT_EQ(popped, expected);
+
+  PairingHeap<int> empty{};
+  empty.meld(odds);
+  ASSERT_TRUE(empty.empty());
+}
+
+TEST(PairingHeapTest, MovingKeepsHandlesValid)
+{
+  PairingHeap<std::string> tasks{ "sleep", "work" };
+  auto eat = tasks.push("eat");
+  PairingHeap<std::string> moved{ std::move(tasks) };
+  ASSERT_TRUE(tasks.empty());
+  moved.decrease_key(eat, "breakfast");
+  ASSERT_EQ(moved.top(), "breakfast");
+  tasks = std::move(moved);
+  ASSERT_EQ(tasks.size(), 3);
+  tasks.clear();
+  ASSERT_TRUE(tasks.empty());
+}
+
+TEST(PairingHeapTest, ManyOperationsKeepTheHeapOrdered)
+{
+  PairingHeap<int> heap{};
+  std::vector<PairingHeap<int>::handle> handles{};
+  for (int i = 0; i < 1000; ++i)
+    handles.push_back(heap.push((i * 7919) % 1000 + 1000));
+  for (int i = 0; i < 1000; i += 3)
+    heap.decrease_key(handles[i], *handles[i] - 1000);
+  int previous = -1;
+  while (!heap.empty()) {
+    int current = heap.pop();
+    ASSERT_LE(previous, current);
+    previous = current;
+  }
+}
@@ -0,0 +1,191 @@
+#include "RadixTrie.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using namespace DataStructures;
+
+namespace {
+
+std::vector<std::string>
+contents_of(const RadixTrie& trie)
+{
+  std::vector<std::string> contents{};
+  for (auto it = trie.begin(); it != trie.end(); ++it)
+    contents.push_back(*it);
+  return contents;
+}
+
+std::vector<std::string>
+with_prefix(const RadixTrie& trie, std::string_view prefix)
+{
+  std::vector<std::string> found{};
+  trie.for_each_with_prefix(
+    prefix, [&found](const std::string& key) { found.push_back(key); });
+  return found;
+}
+
+} // namespace
+
+TEST(RadixTrieTest, EmptyTrieHasNothing)
+{
+  RadixTrie trie{};
+  ASSERT_TRUE(trie.empty());
+  ASSERT_EQ(trie.begin(), trie.end());
+  ASSERT_FALSE(trie.contains(""));
+  ASSERT_FALSE(trie.contains("anything"));
+  ASSERT_FALSE(trie.remove("anything"));
+  ASSERT_TRUE(with_prefix(trie, "").empty());
+}
+
+TEST(RadixTrieTest, IteratesInInsertionOrder)
+{
+  RadixTrie trie{ "romane", "romanus", "romulus", "rubens", "ruber" };
+  ASSERT_EQ(trie.size(), 5);
+  ASSERT_FALSE(trie.insert("romulus"));
+  ASSERT_TRUE(trie.insert("rom"));
+  ASSERT_TRUE(trie.insert(""));
+  ASSERT_EQ(contents_of(trie),
+            (std::vector<std::string>{
+              "romane", "romanus", "romulus", "rubens", "ruber", "rom", "" }));
+}
+
+TEST(RadixTrieTest, ContainsOnlyWholeKeys)
+{
+  RadixTrie trie{ "test", "toaster", "toasting", "slow", "slowly" };
+  ASSERT_TRUE(trie.contains("test"));
+  ASSERT_TRUE(trie.contains("slow"));
+  ASSERT_TRUE(trie.contains("toasting"));
+  ASSERT_FALSE(trie.contains("toast"));
+  ASSERT_FALSE(trie.contains("t"));
+  ASSERT_FALSE(trie.contains("slowl"));
+  ASSERT_FALSE(trie.contains("slowlier"));
+  ASSERT_FALSE(trie.contains(""));
+}
+
+TEST(RadixTrieTest, FindsKeysWithPrefixInLexicographicOrder)
+{
+  RadixTrie trie{ "/usr/lib",       "/usr/bin/env", "/etc/hosts",
+                  "/usr/bin",       "/usr/bin/cc",  "/usr/local/bin",
+                  "/usr/binoculars" };
+  ASSERT_EQ(with_prefix(trie, "/usr/bin"),
+            (std::vector<std::string>{
+              "/usr/bin", "/usr/bin/cc", "/usr/bin/env", "/usr/binoculars" }));
+  ASSERT_EQ(with_prefix(trie, "/usr/l"),
+            (std::vector<std::string>{ "/usr/lib", "/usr/local/bin" }));
+  ASSERT_EQ(with_prefix(trie, "/e"),
+            (std::vector<std::string>{ "/etc/hosts" }));
+  ASSERT_EQ(with_prefix(trie, "").size(), 7);
+  ASSERT_TRUE(with_prefix(trie, "/usr/bin/gcc").empty());
+  ASSERT_TRUE(with_prefix(trie, "/var").empty());
+}
+
+TEST(RadixTrieTest, RemoveKeepsTheRest)
+{
+  RadixTrie trie{ "apple", "app", "application", "apply", "banana" };
+  ASSERT_TRUE(trie.remove("app"));
+  ASSERT_FALSE(trie.remove("app"));
+  ASSERT_FALSE(trie.remove("appl"));
+  ASSERT_TRUE(trie.remove("apple"));
+  ASSERT_EQ(contents_of(trie),
+            (std::vector<std::string>{ "application", "apply", "banana" }));
+  ASSERT_EQ(with_prefix(trie, "app"),
+            (std::vector<std::string>{ "application", "apply" }));
+  ASSERT_TRUE(trie.insert("app"));
+  ASSERT_TRUE(trie.contains("app"));
+  ASSERT_EQ(trie.size(), 4);
+}
+
+TEST(RadixTrieTest, ConstructsFromALinkedList)
+{
+  LinkedList<std::string> hosts{ "example.com", "example.org", "example.com" };
+  RadixTrie trie{ hosts };
+  ASSERT_EQ(contents_of(trie),
+            (std::vector<std::string>{ "example.com", "example.org" }));
+}
+
+TEST(RadixTrieTest, CopiesAreIndependent)
+{
+  RadixTrie original{ "one", "two", "three" };
+  RadixTrie copy{ original };
+  copy.remove("two");
+  copy.insert("four");
+  ASSERT_EQ(contents_of(original),
+            (std::vector<std::string>{ "one", "two", "three" }));
+  ASSERT_EQ(contents_of(copy),
+            (std::vector<std::string>{ "one", "three", "four" }));
+
+  RadixTrie moved{ std::move(copy) };
+  ASSERT_TRUE(copy.empty());
+  ASSERT_TRUE(moved.contains("four"));
+  copy.insert("five");
+  ASSERT_EQ(contents_of(copy), (std::vector<std::string>{ "five" }));
+}
+
+TEST(RadixTrieTest, MovedFromTriesCanBeUsedAgain)
+{
+  static_assert(std::is_nothrow_move_constructible_v<RadixTrie>);
+  static_assert(std::is_nothrow_move_assignable_v<RadixTrie>);
+  RadixTrie source{ "alpha", "alpine" };
+  RadixTrie target{ "beta" };
+  target = std::move(source);
+  ASSERT_TRUE(source.empty());
+  ASSERT_EQ(source.begin(), source.end());
+  ASSERT_FALSE(source.contains(""));
+  ASSERT_FALSE(source.remove("alpha"));
+  ASSERT_TRUE(with_prefix(source, "al").empty());
+  ASSERT_TRUE(source.insert(""));
+  ASSERT_TRUE(source.insert("gamma"));
+  ASSERT_EQ(contents_of(source), (std::vector<std::string>{ "", "gamma" }));
+  ASSERT_EQ(contents_of(target),
+            (std::vector<std::string>{ "alpha", "alpine" }));
+}
+
+TEST(RadixTrieTest, AgreesWithASetUnderRandomUse)
+{
+  // a small alphabet and short keys, so that keys share prefixes and
+  // nodes are split and merged a lot
+  std::mt19937 random{ 5 };
+  auto random_key = [&random]() {
+    std::string key(random() % 6, 'a');
+    for (char& character : key)
+      character = static_cast<char>('a' + random() % 3);
+    return key;
+  };
+
+  RadixTrie trie{};
+  std::set<std::string> reference{};
+  std::vector<std::string> order{};
+  for (int step = 0; step < 5000; ++step) {
+    std::string key = random_key();
+    if (random() % 3 == 0) {
+      bool removed = reference.erase(key) == 1;
+      ASSERT_EQ(trie.remove(key), removed);
+      if (removed)
+        order.erase(std::find(order.begin(), order.end(), key));
+    } else {
+      bool inserted = reference.insert(key).second;
+      ASSERT_EQ(trie.insert(key), inserted);
+      if (inserted)
+        order.push_back(key);
+    }
+    ASSERT_EQ(trie.size(), reference.size());
+
+    std::string probe = random_key();
+    ASSERT_EQ(trie.contains(probe), reference.count(probe) == 1);
+    std::string prefix = probe.substr(0, probe.size() / 2);
+    std::vector<std::string> expected{};
+    for (auto it = reference.lower_bound(prefix);
+         it != reference.end() && it->compare(0, prefix.size(), prefix) == 0;
+         ++it)
+      expected.push_back(*it);
+    ASSERT_EQ(with_prefix(trie, prefix), expected);
+  }
+  ASSERT_EQ(contents_of(trie), order);
+}
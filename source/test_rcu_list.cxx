@@ -0,0 +1,189 @@
+#include "RcuList.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace DataStructures;
+
+namespace {
+
+template<typename T>
+std::vector<T>
+contents_of(const RcuList<T>& list)
+{
+  std::vector<T> contents{};
+  list.for_each([&contents](const T& datum) { contents.push_back(datum); });
+  return contents;
+}
+
+} // namespace
+
+TEST(RcuListTest, EmptyListIsEmpty)
+{
+  RcuList<int> empty{};
+  ASSERT_TRUE(empty.empty());
+  ASSERT_EQ(empty.size(), 0);
+  ASSERT_FALSE(empty.contains(0));
+  ASSERT_TRUE(contents_of(empty).empty());
+}
+
+TEST(RcuListTest, PushesAddAtEitherEnd)
+{
+  RcuList<int> list{ 2, 3 };
+  list.push_front(1);
+  list.push_back(4);
+  ASSERT_EQ(list.size(), 4);
+  ASSERT_EQ(contents_of(list), (std::vector<int>{ 1, 2, 3, 4 }));
+
+  RcuList<int> empty{};
+  empty.push_front(7);
+  empty.push_back(8);
+  ASSERT_EQ(contents_of(empty), (std::vector<int>{ 7, 8 }));
+}
+
+TEST(RcuListTest, RemoveDeletesTheFirstEqualElement)
+{
+  RcuList<std::string> pets{ "cat", "dog", "cat", "emu" };
+  ASSERT_TRUE(pets.remove("cat"));
+  ASSERT_EQ(contents_of(pets),
+            (std::vector<std::string>{ "dog", "cat", "emu" }));
+  ASSERT_TRUE(pets.remove("emu"));
+  ASSERT_FALSE(pets.remove("gnu"));
+  pets.push_back("yak");
+  ASSERT_EQ(contents_of(pets),
+            (std::vector<std::string>{ "dog", "cat", "yak" }));
+  ASSERT_EQ(pets.size(), 3);
+}
+
+TEST(RcuListTest, ReplaceSwapsOneElement)
+{
+  RcuList<int> list{ 1, 2, 3 };
+  ASSERT_TRUE(list.replace(3, 30));
+  ASSERT_TRUE(list.replace(1, 10));
+  ASSERT_FALSE(list.replace(4, 40));
+  list.push_back(4);
+  ASSERT_EQ(contents_of(list), (std::vector<int>{ 10, 2, 30, 4 }));
+}
+
+TEST(RcuListTest, FindCopiesOutTheFirstMatch)
+{
+  RcuList<std::string> routes{ "10.0.0.0/8",
+                               "10.1.0.0/16",
+                               "192.168.0.0/16" };
+  std::string route;
+  ASSERT_TRUE(routes.find(
+    [](const std::string& r) { return r.rfind("10.1.", 0) == 0; }, route));
+  ASSERT_EQ(route, "10.1.0.0/16");
+  ASSERT_FALSE(routes.find(
+    [](const std::string& r) { return r.rfind("172.", 0) == 0; }, route));
+  ASSERT_TRUE(routes.contains("192.168.0.0/16"));
+}
+
+TEST(RcuListTest, MapAndClearReplaceTheWholeList)
+{
+  RcuList<int> list{ 1, 2, 3 };
+  list.map([](const int& x) { return x * x; });
+  list.push_back(16);
+  ASSERT_EQ(contents_of(list), (std::vector<int>{ 1, 4, 9, 16 }));
+  list.clear();
+  ASSERT_TRUE(list.empty());
+  list.push_back(5);
+  ASSERT_EQ(contents_of(list), (std::vector<int>{ 5 }));
+  EpochReclamation::synchronize();
+}
+
+TEST(RcuListTest, ReplacedElementsAreFreedWithoutASynchronize)
+{
+  EpochReclamation::synchronize();
+  RcuList<std::string> list{ "old" };
+  list.replace("old", "new");
+  ASSERT_EQ(EpochReclamation::pending(), 1);
+  EpochReclamation::reclaim();
+  ASSERT_EQ(EpochReclamation::pending(), 0);
+  list.clear();
+  ASSERT_EQ(EpochReclamation::pending(), 0);
+}
+
+TEST(RcuListTest, ReadersNeverWalkFreedElements)
+{
+  // the values are too long to be stored inline, so a walk over an
+  // element or chain freed under it reads freed memory, which the
+  // sanitizers report
+  const std::string prefix = "a route long enough for the heap ";
+  RcuList<std::string> list{};
+  std::atomic<bool> done{ false };
+  std::atomic<int> bad_reads{ 0 };
+  std::thread reader{ [&]() {
+    while (!done)
+      list.for_each([&](const std::string& route) {
+        if (route.rfind(prefix, 0) != 0)
+          bad_reads.fetch_add(1);
+      });
+  } };
+
+  for (int round = 0; round < 2000; ++round) {
+    for (int i = 0; i < 8; ++i)
+      list.push_back(prefix + std::to_string(i));
+    list.replace(prefix + "3", prefix + "33");
+    list.remove(prefix + "5");
+    if (round % 4 == 0)
+      list.map([](const std::string& route) { return route + "!"; });
+    list.clear();
+  }
+  done = true;
+  reader.join();
+  ASSERT_EQ(bad_reads.load(), 0);
+  EpochReclamation::synchronize();
+}
+
+TEST(RcuListTest, ReadersSeeWholeListsWhileWritersChangeThem)
+{
+  // the even elements are never touched, so every walk must see them all;
+  // the odd ones are replaced, removed and put back
+  const int length = 64;
+  RcuList<int> list{};
+  for (int i = 0; i < length; ++i)
+    list.push_back(i);
+
+  std::atomic<bool> done{ false };
+  std::atomic<int> bad_walks{ 0 };
+  std::vector<std::thread> readers{};
+  for (int r = 0; r < 3; ++r)
+    readers.emplace_back([&]() {
+      while (!done.load()) {
+        int evens = 0;
+        int previous_even = -2;
+        list.for_each([&](const int& datum) {
+          if (datum % 2 == 0 && datum < length) {
+            if (datum != previous_even + 2)
+              bad_walks.fetch_add(1);
+            previous_even = datum;
+            evens += 1;
+          }
+        });
+        if (evens != length / 2)
+          bad_walks.fetch_add(1);
+      }
+    });
+
+  for (int round = 0; round < 200; ++round) {
+    for (int odd = 1; odd < length; odd += 2) {
+      list.replace(odd, odd + 1001);
+      list.remove(odd + 1001);
+    }
+    for (int odd = 1; odd < length; odd += 2)
+      list.push_back(odd);
+    list.map([](const int& x) { return x; });
+  }
+  done.store(true);
+  for (std::thread& reader : readers)
+    reader.join();
+
+  ASSERT_EQ(bad_walks.load(), 0);
+  ASSERT_EQ(list.size(), length);
+  EpochReclamation::synchronize();
+}
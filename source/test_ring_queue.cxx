@@ -0,0 +1,152 @@
+#include "RingQueue.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+using namespace DataStructures;
+
+using Policy = RingQueue<int>::FullPolicy;
+
+TEST(RingQueueTest, EmptyQueueIsEmpty)
+{
+  RingQueue<int> empty{};
+  ASSERT_TRUE(empty.empty());
+  ASSERT_EQ(empty.size(), 0);
+}
+
+TEST(RingQueueTest, CapacityIsRoundedUpToAPowerOfTwo)
+{
+  ASSERT_EQ(RingQueue<int>(0).capacity(), 1);
+  ASSERT_EQ(RingQueue<int>(1).capacity(), 1);
+  ASSERT_EQ(RingQueue<int>(5).capacity(), 8);
+  ASSERT_EQ(RingQueue<int>(64).capacity(), 64);
+}
+
+TEST(RingQueueTest, PopFrontGivesElementsInTheOrderTheyWerePushed)
+{
+  RingQueue<std::string> checkout{ "Alice", "Bob" };
+  checkout.push_back("Carol");
+  ASSERT_EQ(checkout.front(), "Alice");
+  ASSERT_EQ(checkout.cback(), "Carol");
+  ASSERT_EQ(checkout.pop_front(), "Alice");
+  ASSERT_EQ(checkout.pop_front(), "Bob");
+  checkout.push_back("Dan");
+  ASSERT_EQ(checkout.cfront(), "Carol");
+  ASSERT_EQ(checkout.back(), "Dan");
+  ASSERT_EQ(checkout.size(), 2);
+  // empty.pop_front() is undefined
+}
+
+TEST(RingQueueTest, IndicesWrapAroundTheBuffer)
+{
+  RingQueue<int> window(4, Policy::reject);
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_TRUE(window.push_back(i));
+    ASSERT_TRUE(window.push_back(i + 1000));
+    ASSERT_EQ(window.pop_front(), i);
+    ASSERT_EQ(window.pop_front(), i + 1000);
+  }
+  ASSERT_TRUE(window.empty());
+  ASSERT_EQ(window.capacity(), 4);
+}
+
+TEST(RingQueueTest, GrowingQueueKeepsEverything)
+{
+  RingQueue<int> samples(2, Policy::grow);
+  samples.push_back(-1);
+  samples.pop_front();
+  for (int i = 0; i < 20; ++i)
+    ASSERT_TRUE(samples.push_back(i));
+  ASSERT_EQ(samples.size(), 20);
+  ASSERT_EQ(samples.capacity(), 32);
+  for (int i = 0; i < 20; ++i)
+    ASSERT_EQ(samples.pop_front(), i);
+}
+
+TEST(RingQueueTest, OverwritingQueueDropsTheOldest)
+{
+  RingQueue<int> recent(4, Policy::overwrite);
+  for (int i = 0; i < 10; ++i)
+    ASSERT_TRUE(recent.push_back(i));
+  ASSERT_TRUE(recent.full());
+  ASSERT_EQ(recent.size(), 4);
+  ASSERT_EQ(recent.front(), 6);
+  ASSERT_EQ(recent.back(), 9);
+}
+
+TEST(RingQueueTest, RejectingQueueRefusesWhenFull)
+{
+  RingQueue<std::string> table_for_two(2, RingQueue<std::string>::FullPolicy::reject);
+  ASSERT_TRUE(table_for_two.push_back("Romeo"));
+  ASSERT_TRUE(table_for_two.push_back("Juliet"));
+  ASSERT_FALSE(table_for_two.push_back("Mercutio"));
+  ASSERT_EQ(table_for_two.back(), "Juliet");
+  ASSERT_EQ(table_for_two.size(), 2);
+}
+
+TEST(RingQueueTest, ClearRemovesAllElements)
+{
+  RingQueue<std::string> chores{ "dishes", "laundry", "vacuuming" };
+  chores.clear();
+  ASSERT_TRUE(chores.empty());
+  chores.push_back("nap");
+  ASSERT_EQ(chores.front(), "nap");
+}
+
+TEST(RingQueueTest, CopiesAndMovesKeepTheOrder)
+{
+  RingQueue<std::string> months(4, RingQueue<std::string>::FullPolicy::overwrite);
+  for (auto month : { "January", "February", "March", "April", "May" })
+    months.push_back(month);
+
+  RingQueue<std::string> copy{ months };
+  ASSERT_EQ(copy.pop_front(), "February");
+  ASSERT_EQ(months.front(), "February");
+  copy.push_back("June");
+  copy.push_back("July");
+  ASSERT_EQ(copy.front(), "April");
+
+  RingQueue<std::string> assigned{ "Smarch" };
+  assigned = months;
+  ASSERT_EQ(assigned.size(), 4);
+  ASSERT_EQ(assigned.back(), "May");
+
+  RingQueue<std::string> moved{ std::move(months) };
+  ASSERT_TRUE(months.empty());
+  ASSERT_EQ(moved.pop_front(), "February");
+  assigned = std::move(moved);
+  ASSERT_EQ(assigned.size(), 3);
+  ASSERT_EQ(assigned.front(), "March");
+}
+
+TEST(RingQueueTest, PushingAnElementOfAFullQueueCopiesItFirst)
+{
+  using Queue = RingQueue<std::string>;
+  Queue growing(2, Queue::FullPolicy::grow);
+  growing.push_back("a rather long string, so it lives on the heap");
+  growing.push_back("and another one just as long as the first");
+  growing.push_back(growing.front());
+  ASSERT_EQ(growing.size(), 3);
+  ASSERT_EQ(growing.back(), "a rather long string, so it lives on the heap");
+
+  Queue overwriting(2, Queue::FullPolicy::overwrite);
+  overwriting.push_back("the oldest, which makes way for its own copy");
+  overwriting.push_back("the newest");
+  overwriting.push_back(overwriting.front());
+  ASSERT_EQ(overwriting.pop_front(), "the newest");
+  ASSERT_EQ(overwriting.pop_front(),
+            "the oldest, which makes way for its own copy");
+}
+
+TEST(RingQueueTest, MovedFromQueuesCanBeUsedAgain)
+{
+  RingQueue<int> original{ 1, 2, 3 };
+  RingQueue<int> moved{ std::move(original) };
+  ASSERT_EQ(original.capacity(), 0);
+  original.push_back(4);
+  original.push_back(5);
+  ASSERT_EQ(original.pop_front(), 4);
+  ASSERT_EQ(original.pop_front(), 5);
+  ASSERT_EQ(moved.size(), 3);
+}
@@ -0,0 +1,197 @@
+#include "SkipList.h"
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace DataStructures;
+
+TEST(SkipListTest, EmptyListIsEmpty)
+{
+  SkipList<int> empty{};
+  ASSERT_TRUE(empty.empty());
+  ASSERT_EQ(empty.size(), 0);
+  ASSERT_TRUE(empty.begin() == empty.end());
+}
+
+TEST(SkipListTest, IterationIsInAscendingOrder)
+{
+  SkipList<int> primes{ 13, 2, 7, 5, 11, 3 };
+  std::vector<int> in_order{ 2, 3, 5, 7, 11, 13 };
+  std::vector<int> iterated{};
+  for (int prime : primes)
+    iterated.push_back(prime);
+  ASSERT_EQ(iterated, in_order);
+  ASSERT_EQ(primes.size(), 6);
+}
+
+TEST(SkipListTest, InsertRejectsDuplicates)
+{
+  SkipList<std::string> cheeses{ "gouda", "brie" };
+  ASSERT_TRUE(cheeses.insert("stilton"));
+  ASSERT_FALSE(cheeses.insert("brie"));
+  ASSERT_EQ(cheeses.size(), 3);
+}
+
+TEST(SkipListTest, FindGivesTheEquivalentElementOrEnd)
+{
+  SkipList<std::string> cheeses{ "gouda", "brie", "stilton", "manchego" };
+  ASSERT_EQ(*cheeses.find("manchego"), "manchego");
+  ASSERT_TRUE(cheeses.find("velveeta") == cheeses.end());
+
+  SkipList<std::string> empty{};
+  ASSERT_TRUE(empty.find("gouda") == empty.end());
+}
+
+TEST(SkipListTest, LowerBoundGivesTheFirstElementNotBeforeTheValue)
+{
+  SkipList<int> squares{ 1, 4, 9, 16, 25 };
+  ASSERT_EQ(*squares.lower_bound(9), 9);
+  ASSERT_EQ(*squares.lower_bound(10), 16);
+  ASSERT_EQ(*squares.lower_bound(-3), 1);
+  ASSERT_TRUE(squares.lower_bound(26) == squares.end());
+}
+
+TEST(SkipListTest, EraseDeletesTheEquivalentElement)
+{
+  SkipList<int> squares{ 1, 4, 9, 16, 25 };
+  ASSERT_TRUE(squares.erase(9));
+  ASSERT_FALSE(squares.erase(9));
+  ASSERT_TRUE(squares.erase(1));
+  ASSERT_TRUE(squares.erase(25));
+  ASSERT_EQ(squares.size(), 2);
+  ASSERT_TRUE(squares.find(9) == squares.end());
+  ASSERT_EQ(*squares.begin(), 4);
+
+  ASSERT_TRUE(squares.erase(4));
+  ASSERT_TRUE(squares.erase(16));
+  ASSERT_TRUE(squares.empty());
+  ASSERT_TRUE(squares.insert(36));
+  ASSERT_EQ(*squares.begin(), 36);
+}
+
+TEST(SkipListTest, CustomComparisonOrdersTheList)
+{
+  SkipList<int, std::greater<int>> countdown{ 1, 3, 2, 5, 4 };
+  std::vector<int> in_order{ 5, 4, 3, 2, 1 };
+  std::vector<int> iterated{};
+  for (int count : countdown)
+    iterated.push_back(count);
+  ASSERT_EQ(iterated, in_order);
+  ASSERT_EQ(*countdown.lower_bound(6), 5);
+}
+
+TEST(SkipListTest, LevelProbabilityDoesNotChangeTheContents)
+{
+  for (double level_probability : { 0.01, 0.25, 0.5, 0.99 }) {
+    SkipList<int> evens(level_probability);
+    for (int i = 1000; i > 0; --i)
+      evens.insert(2 * i);
+    ASSERT_EQ(evens.size(), 1000);
+    int expected = 2;
+    for (int even : evens) {
+      ASSERT_EQ(even, expected);
+      expected += 2;
+    }
+    ASSERT_TRUE(evens.find(999) == evens.end());
+    ASSERT_EQ(*evens.lower_bound(999), 1000);
+  }
+}
+
+TEST(SkipListTest, CopiesAreIndependent)
+{
+  SkipList<int> fibonacci{ 1, 2, 3, 5, 8 };
+  SkipList<int> fibonacci_copy{ fibonacci };
+  fibonacci_copy.insert(13);
+  fibonacci.erase(1);
+  ASSERT_EQ(fibonacci.size(), 4);
+  ASSERT_EQ(fibonacci_copy.size(), 6);
+  ASSERT_EQ(*fibonacci_copy.begin(), 1);
+  ASSERT_EQ(*fibonacci_copy.find(13), 13);
+
+  SkipList<int> assigned{ 42 };
+  assigned = fibonacci_copy;
+  ASSERT_EQ(assigned.size(), 6);
+  ASSERT_TRUE(assigned.find(42) == assigned.end());
+  ASSERT_EQ(*assigned.lower_bound(4), 5);
+}
+
+TEST(SkipListTest, MovingTransfersTheData)
+{
+  SkipList<std::string> planets{ "Mercury", "Venus", "Earth", "Mars" };
+  SkipList<std::string> moved{ std::move(planets) };
+  ASSERT_EQ(moved.size(), 4);
+  ASSERT_TRUE(planets.empty());
+  ASSERT_EQ(*moved.begin(), "Earth");
+
+  SkipList<std::string> gas_giants{ "Jupiter", "Saturn" };
+  gas_giants = std::move(moved);
+  ASSERT_EQ(gas_giants.size(), 4);
+  ASSERT_EQ(*gas_giants.find("Mars"), "Mars");
+}
+
+TEST(SkipListTest, ConcurrentInsertsAreAllKept)
+{
+  const int number_of_threads = 4;
+  const int inserts_per_thread = 500;
+  SkipList<int, std::less<int>, true> shared{};
+  std::vector<std::thread> threads{};
+  for (int t = 0; t < number_of_threads; ++t) {
+    threads.emplace_back([&shared, t]() {
+      // interleave the threads' keys and have each insert one key twice
+      for (int i = 0; i < inserts_per_thread; ++i) {
+        shared.insert(i * number_of_threads + t);
+        ASSERT_TRUE(shared.find(i * number_of_threads + t) != shared.end());
+      }
+      shared.insert(t);
+    });
+  }
+  for (auto& thread : threads)
+    thread.join();
+
+  ASSERT_EQ(shared.size(), number_of_threads * inserts_per_thread);
+  int expected = 0;
+  for (int value : shared) {
+    ASSERT_EQ(value, expected);
+    expected += 1;
+  }
+}
+
+TEST(SkipListTest, HeightsAreGeometricAndIndependent)
+{
+  // inserted in ascending order, so the elements are visited in the
+  // order their heights were drawn
+  const int count = 20000;
+  SkipList<int> list{};
+  for (int i = 0; i < count; ++i)
+    list.insert(i);
+  std::vector<size_t> heights{};
+  for (auto it = list.begin(); it != list.end(); ++it)
+    heights.push_back(list.tower_height(it));
+
+  int promoted = 0;
+  int promoted_twice = 0;
+  int promoted_after_promoted = 0;
+  int one_lower_after_tall = 0;
+  int tall = 0;
+  for (int i = 0; i < count; ++i) {
+    promoted += heights[i] >= 2;
+    promoted_twice += heights[i] >= 3;
+    if (i + 1 == count)
+      continue;
+    promoted_after_promoted += heights[i] >= 2 && heights[i + 1] >= 2;
+    if (heights[i] >= 3) {
+      tall += 1;
+      one_lower_after_tall += heights[i + 1] == heights[i] - 1;
+    }
+  }
+  // each within a few standard deviations of what independent fair
+  // coin flips would give
+  ASSERT_NEAR(promoted, count / 2, 300);
+  ASSERT_NEAR(promoted_twice, count / 4, 300);
+  ASSERT_NEAR(promoted_after_promoted, count / 4, 300);
+  ASSERT_LT(one_lower_after_tall, tall / 2);
+}
@@ -0,0 +1,135 @@
+#include "SlotMap.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string>
+#include <vector>
+
+using namespace DataStructures;
+
+TEST(SlotMapTest, EmptyMapIsEmpty)
+{
+  SlotMap<int> empty{};
+  ASSERT_TRUE(empty.empty());
+  ASSERT_EQ(empty.size(), 0);
+  ASSERT_TRUE(empty.begin() == empty.end());
+}
+
+TEST(SlotMapTest, HandlesAreSixtyFourBits)
+{
+  ASSERT_EQ(sizeof(SlotMap<std::string>::handle), 8);
+}
+
+TEST(SlotMapTest, InsertGivesAHandleToTheNewElement)
+{
+  SlotMap<std::string> tools{};
+  auto hammer = tools.insert("hammer");
+  auto wrench = tools.insert("wrench");
+  ASSERT_NE(hammer, wrench);
+  ASSERT_EQ(tools[hammer], "hammer");
+  ASSERT_EQ(*tools.find(wrench), "wrench");
+  ASSERT_EQ(tools.size(), 2);
+
+  tools[hammer] = "sledgehammer";
+  ASSERT_EQ(*tools.find(hammer), "sledgehammer");
+}
+
+TEST(SlotMapTest, IterationVisitsEveryElementInInsertionOrder)
+{
+  SlotMap<int> triangular_numbers{ 1, 3, 6, 10, 15 };
+  std::vector<int> expected{ 1, 3, 6, 10, 15 };
+  std::vector<int> iterated{};
+  for (int number : triangular_numbers)
+    iterated.push_back(number);
+  ASSERT_EQ(iterated, expected);
+}
+
+TEST(SlotMapTest, EraseMakesOnlyThatHandleStale)
+{
+  SlotMap<std::string> crew{};
+  auto kirk = crew.insert("Kirk");
+  auto spock = crew.insert("Spock");
+  auto redshirt = crew.insert("Ensign Ricky");
+  auto mccoy = crew.insert("McCoy");
+
+  ASSERT_TRUE(crew.erase(redshirt));
+  ASSERT_FALSE(crew.erase(redshirt));
+  ASSERT_FALSE(crew.contains(redshirt));
+  ASSERT_EQ(crew.find(redshirt), nullptr);
+  ASSERT_EQ(crew.size(), 3);
+
+  ASSERT_EQ(crew[kirk], "Kirk");
+  ASSERT_EQ(crew[spock], "Spock");
+  ASSERT_EQ(crew[mccoy], "McCoy");
+
+  ASSERT_TRUE(crew.erase(kirk));
+  ASSERT_EQ(crew[spock], "Spock");
+  ASSERT_EQ(crew[mccoy], "McCoy");
+}
+
+TEST(SlotMapTest, ReusedSlotsDoNotReviveOldHandles)
+{
+  SlotMap<int> answers{};
+  auto old_answer = answers.insert(41);
+  answers.erase(old_answer);
+  auto new_answer = answers.insert(42);
+  ASSERT_EQ(new_answer.slot, old_answer.slot);
+  ASSERT_FALSE(answers.contains(old_answer));
+  ASSERT_EQ(answers.find(old_answer), nullptr);
+  ASSERT_EQ(answers[new_answer], 42);
+}
+
+TEST(SlotMapTest, DefaultHandleIsNeverContained)
+{
+  SlotMap<int> numbers{ 0, 1, 2 };
+  SlotMap<int>::handle nothing{};
+  ASSERT_FALSE(numbers.contains(nothing));
+  ASSERT_FALSE(numbers.erase(nothing));
+
+  // default initialised over memory that would otherwise read as a
+  // live handle to the first element
+  alignas(SlotMap<int>::handle) unsigned char
+    storage[sizeof(SlotMap<int>::handle)];
+  const uint32_t live[2] = { 0, 1 };
+  std::memcpy(storage, live, sizeof(storage));
+  auto* garbage = new (storage) SlotMap<int>::handle;
+  ASSERT_FALSE(numbers.contains(*garbage));
+  ASSERT_EQ(numbers.find(*garbage), nullptr);
+}
+
+TEST(SlotMapTest, ConstMapsCanBeIterated)
+{
+  const SlotMap<std::string> colours{ "red", "green", "blue" };
+  std::vector<std::string> iterated{};
+  for (const std::string& colour : colours)
+    iterated.push_back(colour);
+  ASSERT_EQ(iterated, (std::vector<std::string>{ "red", "green", "blue" }));
+}
+
+TEST(SlotMapTest, ClearMakesEveryHandleStale)
+{
+  SlotMap<std::string> pantry{};
+  auto flour = pantry.insert("flour");
+  auto sugar = pantry.insert("sugar");
+  pantry.clear();
+  ASSERT_TRUE(pantry.empty());
+  ASSERT_FALSE(pantry.contains(flour));
+  ASSERT_FALSE(pantry.contains(sugar));
+  auto salt = pantry.insert("salt");
+  ASSERT_EQ(pantry[salt], "salt");
+  ASSERT_EQ(pantry.size(), 1);
+}
+
+TEST(SlotMapTest, CopiesAreIndependent)
+{
+  SlotMap<int> original{};
+  auto seven = original.insert(7);
+  SlotMap<int> copy{ original };
+  copy[seven] = 8;
+  ASSERT_EQ(original[seven], 7);
+  original.erase(seven);
+  ASSERT_TRUE(copy.contains(seven));
+}
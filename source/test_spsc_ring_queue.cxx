@@ -0,0 +1,79 @@
+#include "SpscRingQueue.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+
+using namespace DataStructures;
+
+TEST(SpscRingQueueTest, IndicesAreOnSeparateCacheLines)
+{
+  size_t cache_line_size = SpscRingQueue<int>::cache_line_size;
+  ASSERT_GE(alignof(SpscRingQueue<int>), cache_line_size);
+  ASSERT_GE(sizeof(SpscRingQueue<int>), 3 * cache_line_size);
+}
+
+TEST(SpscRingQueueTest, PopFrontGivesElementsInTheOrderTheyWerePushed)
+{
+  SpscRingQueue<std::string> pipeline{ 4 };
+  ASSERT_TRUE(pipeline.empty());
+  ASSERT_TRUE(pipeline.push_back("fetch"));
+  ASSERT_TRUE(pipeline.push_back("decode"));
+  ASSERT_EQ(pipeline.front(), "fetch");
+  ASSERT_EQ(pipeline.back(), "decode");
+  ASSERT_EQ(pipeline.pop_front(), "fetch");
+  ASSERT_EQ(pipeline.size(), 1);
+}
+
+TEST(SpscRingQueueTest, PushBackRejectsWhenFull)
+{
+  SpscRingQueue<int> tiny{ 3 };
+  ASSERT_EQ(tiny.capacity(), 4);
+  for (int i = 0; i < 4; ++i)
+    ASSERT_TRUE(tiny.push_back(i));
+  ASSERT_TRUE(tiny.full());
+  ASSERT_FALSE(tiny.push_back(4));
+  ASSERT_EQ(tiny.pop_front(), 0);
+  ASSERT_TRUE(tiny.push_back(4));
+  ASSERT_EQ(tiny.back(), 4);
+}
+
+TEST(SpscRingQueueTest, TryPopFrontReportsAnEmptyQueue)
+{
+  SpscRingQueue<int> queue{ 2 };
+  int popped = -1;
+  ASSERT_FALSE(queue.try_pop_front(popped));
+  ASSERT_EQ(popped, -1);
+  queue.push_back(7);
+  ASSERT_TRUE(queue.try_pop_front(popped));
+  ASSERT_EQ(popped, 7);
+}
+
+TEST(SpscRingQueueTest, ConsumerSeesEveryElementOfTheProducer)
+{
+  const int number_of_elements = 100000;
+  SpscRingQueue<int> queue{ 64 };
+  std::thread producer{ [&queue]() {
+    for (int i = 0; i < number_of_elements; ++i)
+      while (!queue.push_back(i)) {
+        std::this_thread::yield();
+      }
+  } };
+
+  long long sum = 0;
+  int expected = 0;
+  while (expected < number_of_elements) {
+    int popped;
+    if (!queue.try_pop_front(popped)) {
+      std::this_thread::yield();
+      continue;
+    }
+    ASSERT_EQ(popped, expected);
+    sum += popped;
+    expected += 1;
+  }
+  producer.join();
+  ASSERT_EQ(sum, (long long)number_of_elements * (number_of_elements - 1) / 2);
+  ASSERT_TRUE(queue.empty());
+}
@@ -0,0 +1,117 @@
+#include "StaticList.h"
+
+#include <gtest/gtest.h>
+
+#include <string_view>
+
+using namespace DataStructures;
+
+namespace {
+
+// lives in read-only data; no code runs to build it
+constexpr StaticList<std::string_view, 4> weekend_days{ "Saturday",
+                                                       "Sunday" };
+
+constexpr StaticList<int, 8>
+first_squares()
+{
+  StaticList<int, 8> squares{ 1, 2, 3, 4, 5 };
+  squares.map([](const int& x) { return x * x; });
+  return squares;
+}
+
+constexpr int
+sum_of(const StaticList<int, 8>& list)
+{
+  int sum = 0;
+  for (auto it = list.begin(); it != list.end(); ++it)
+    sum += *it;
+  return sum;
+}
+
+constexpr StaticList<int, 4>
+churned()
+{
+  // fills, empties and refills, so that every place is reused
+  StaticList<int, 4> list{};
+  list.push_back(1);
+  list.push_back(2);
+  list.push_front(0);
+  list.push_back(3);
+  list.pop_front();
+  list.pop_back();
+  list.remove(1);
+  list.push_front(7);
+  list.push_back(8);
+  list.push_back(9);
+  return list;
+}
+
+} // namespace
+
+static_assert(StaticList<int, 3>{}.empty());
+static_assert(StaticList<int, 3>{ 1, 2, 3 }.full());
+static_assert(weekend_days.size() == 2);
+static_assert(weekend_days.cfront() == "Saturday");
+static_assert(weekend_days.cback() == "Sunday");
+static_assert(first_squares() == StaticList<int, 5>{ 1, 4, 9, 16, 25 });
+static_assert(sum_of(first_squares()) == 55);
+static_assert(churned() == StaticList<int, 4>{ 7, 2, 8, 9 });
+static_assert(churned() != StaticList<int, 4>{ 7, 2, 8 });
+static_assert(StaticList<int, 2>{ 5, 6 }.capacity() == 2);
+
+TEST(StaticListTest, EmptyListIsEmpty)
+{
+  StaticList<int, 4> empty{};
+  ASSERT_TRUE(empty.empty());
+  ASSERT_FALSE(empty.full());
+  ASSERT_EQ(empty.size(), 0);
+  ASSERT_EQ(empty.begin(), empty.end());
+}
+
+TEST(StaticListTest, PushesAndPopsWorkAtEitherEnd)
+{
+  StaticList<int, 3> list{};
+  list.push_back(2);
+  list.push_front(1);
+  list.push_back(3);
+  ASSERT_TRUE(list.full());
+  ASSERT_EQ(list.front(), 1);
+  ASSERT_EQ(list.back(), 3);
+  ASSERT_EQ(list.pop_back(), 3);
+  ASSERT_EQ(list.pop_front(), 1);
+  ASSERT_EQ(list.pop_back(), 2);
+  ASSERT_TRUE(list.empty());
+  list.push_front(4);
+  ASSERT_EQ(list.front(), list.back());
+}
+
+TEST(StaticListTest, RemoveDeletesTheFirstEqualElement)
+{
+  StaticList<char, 6> letters{ 'l', 'e', 'v', 'e', 'l' };
+  ASSERT_TRUE(letters.remove('l'));
+  ASSERT_TRUE(letters.remove('l'));
+  ASSERT_FALSE(letters.remove('l'));
+  ASSERT_EQ(letters, (StaticList<char, 3>{ 'e', 'v', 'e' }));
+  letters.push_back('n');
+  ASSERT_EQ(letters.back(), 'n');
+}
+
+TEST(StaticListTest, ClearMakesRoomForEverything)
+{
+  StaticList<int, 2> list{ 1, 2 };
+  list.clear();
+  ASSERT_TRUE(list.empty());
+  list.push_back(3);
+  list.push_back(4);
+  ASSERT_EQ(list, (StaticList<int, 2>{ 3, 4 }));
+}
+
+TEST(StaticListTest, CompileTimeListsWorkAtRunTime)
+{
+  int sum = 0;
+  for (auto it = weekend_days.begin(); it != weekend_days.end(); ++it)
+    sum += static_cast<int>((*it).size());
+  ASSERT_EQ(sum, 14);
+  ASSERT_EQ(sum_of(first_squares()), 55);
+}
@@ -0,0 +1,207 @@
+#include "TimingWheel.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace DataStructures;
+
+namespace {
+
+template<typename T>
+std::vector<T>
+contents_of(const LinkedList<T>& list)
+{
+  std::vector<T> contents{};
+  for (auto it = list.begin(); it != list.end(); ++it)
+    contents.push_back(*it);
+  return contents;
+}
+
+} // namespace
+
+TEST(TimingWheelTest, EmptyWheelExpiresNothing)
+{
+  TimingWheel<int> wheel{};
+  ASSERT_TRUE(wheel.empty());
+  ASSERT_TRUE(wheel.advance(1000).empty());
+  ASSERT_EQ(wheel.time(), 1000);
+  ASSERT_FALSE(wheel.pending(TimingWheel<int>::handle{}));
+}
+
+TEST(TimingWheelTest, TimersExpireInOrderOfDeadline)
+{
+  TimingWheel<std::string> wheel{ 100 };
+  wheel.schedule(130, "third");
+  wheel.schedule(101, "first");
+  wheel.schedule(120, "second");
+  wheel.schedule(400, "fourth");
+  ASSERT_EQ(wheel.size(), 4);
+  ASSERT_TRUE(wheel.advance(100).empty());
+  ASSERT_EQ(contents_of(wheel.advance(129)),
+            (std::vector<std::string>{ "first", "second" }));
+  ASSERT_EQ(contents_of(wheel.advance(1000)),
+            (std::vector<std::string>{ "third", "fourth" }));
+  ASSERT_TRUE(wheel.empty());
+}
+
+TEST(TimingWheelTest, PastDeadlinesAreDueAtTheNextTick)
+{
+  TimingWheel<int> wheel{ 50 };
+  wheel.schedule(10, 1);
+  wheel.schedule(50, 2);
+  ASSERT_TRUE(wheel.advance(50).empty());
+  ASSERT_EQ(wheel.advance(51).size(), 2);
+}
+
+TEST(TimingWheelTest, CancelledTimersNeverExpire)
+{
+  TimingWheel<int> wheel{};
+  auto doomed = wheel.schedule(5, 1);
+  auto kept = wheel.schedule(5, 2);
+  auto far = wheel.schedule(70000, 3);
+  ASSERT_TRUE(wheel.cancel(doomed));
+  ASSERT_FALSE(wheel.cancel(doomed));
+  ASSERT_FALSE(wheel.pending(doomed));
+  ASSERT_TRUE(wheel.cancel(far));
+  ASSERT_EQ(contents_of(wheel.advance(100000)), (std::vector<int>{ 2 }));
+  ASSERT_FALSE(wheel.pending(kept));
+  ASSERT_FALSE(wheel.cancel(kept));
+}
+
+TEST(TimingWheelTest, DefaultHandlesCancelNothing)
+{
+  TimingWheel<int> wheel{};
+  auto first = wheel.schedule(5, 1);
+  TimingWheel<int>::handle fresh;
+  ASSERT_FALSE(wheel.cancel(TimingWheel<int>::handle{}));
+  ASSERT_FALSE(wheel.cancel(TimingWheel<int>::handle()));
+  ASSERT_FALSE(wheel.cancel(fresh));
+
+  // default initialised over memory that would otherwise read as a
+  // live handle to the first timer
+  alignas(TimingWheel<int>::handle) unsigned char
+    storage[sizeof(TimingWheel<int>::handle)];
+  const uint32_t live[2] = { 0, 1 };
+  std::memcpy(storage, live, sizeof(storage));
+  auto* garbage = new (storage) TimingWheel<int>::handle;
+  ASSERT_FALSE(wheel.cancel(*garbage));
+  ASSERT_TRUE(wheel.pending(first));
+}
+
+TEST(TimingWheelTest, HandlesToReusedTimersAreStale)
+{
+  TimingWheel<int> wheel{};
+  auto old_timer = wheel.schedule(3, 1);
+  wheel.cancel(old_timer);
+  auto new_timer = wheel.schedule(3, 2);
+  ASSERT_EQ(new_timer.slot, old_timer.slot);
+  ASSERT_NE(new_timer, old_timer);
+  ASSERT_FALSE(wheel.cancel(old_timer));
+  ASSERT_TRUE(wheel.pending(new_timer));
+}
+
+TEST(TimingWheelTest, DistantTimersCascadeDownAndExpireOnTime)
+{
+  TimingWheel<uint64_t> wheel{ 12345 };
+  std::vector<uint64_t> deadlines{ 12345 + 255,
+                                   12345 + 256,
+                                   12345 + 65537,
+                                   uint64_t{ 1 } << 24,
+                                   (uint64_t{ 1 } << 32) + 7,
+                                   uint64_t{ 1 } << 40 };
+  for (uint64_t deadline : deadlines)
+    wheel.schedule(deadline, deadline);
+  for (uint64_t deadline : deadlines) {
+    ASSERT_TRUE(wheel.advance(deadline - 1).empty());
+    ASSERT_EQ(contents_of(wheel.advance(deadline)),
+              (std::vector<uint64_t>{ deadline }));
+  }
+  ASSERT_TRUE(wheel.empty());
+}
+
+TEST(TimingWheelTest, TimeRunsUpToTheLastTickWithoutWrapping)
+{
+  const uint64_t last = UINT64_MAX;
+  // in the span before the last, so the furthest timer starts out on the
+  // overflow list
+  TimingWheel<int> wheel{ last - (uint64_t{ 1 } << 32) - 10 };
+  wheel.schedule(last - 5, 2);
+  wheel.schedule(last, 3);
+  wheel.schedule(last - (uint64_t{ 1 } << 31), 1);
+  ASSERT_EQ(contents_of(wheel.advance(last - 6)), (std::vector<int>{ 1 }));
+  ASSERT_EQ(wheel.time(), last - 6);
+  // each of these is due at the same tick as one already scheduled
+  wheel.schedule(0, 4);
+  std::vector<int> expired = contents_of(wheel.advance(last - 1));
+  std::sort(expired.begin(), expired.end());
+  ASSERT_EQ(expired, (std::vector<int>{ 2, 4 }));
+  wheel.schedule(0, 5);
+  expired = contents_of(wheel.advance(last));
+  std::sort(expired.begin(), expired.end());
+  ASSERT_EQ(expired, (std::vector<int>{ 3, 5 }));
+  ASSERT_EQ(wheel.time(), last);
+  ASSERT_TRUE(wheel.empty());
+  ASSERT_TRUE(wheel.advance(last).empty());
+  ASSERT_EQ(wheel.time(), last);
+}
+
+TEST(TimingWheelTest, AgreesWithASortedMapUnderRandomUse)
+{
+  std::mt19937_64 random{ 2024 };
+  TimingWheel<int> wheel{};
+  std::multimap<uint64_t, int> expected{};
+  std::map<int, TimingWheel<int>::handle> handles{};
+  std::map<int, uint64_t> deadline_of{};
+  uint64_t now = 0;
+  int next_id = 0;
+
+  for (int round = 0; round < 2000; ++round) {
+    for (int i = 0; i < 20; ++i) {
+      uint64_t delay = random() % (uint64_t{ 1 } << (random() % 34));
+      uint64_t deadline = now + 1 + delay;
+      handles[next_id] = wheel.schedule(deadline, next_id);
+      expected.emplace(deadline, next_id);
+      deadline_of[next_id] = deadline;
+      next_id += 1;
+    }
+    if (!handles.empty() && random() % 2 == 0) {
+      auto victim = handles.begin();
+      std::advance(victim, random() % handles.size());
+      ASSERT_TRUE(wheel.cancel(victim->second));
+      auto range = expected.equal_range(deadline_of[victim->first]);
+      for (auto it = range.first; it != range.second; ++it)
+        if (it->second == victim->first) {
+          expected.erase(it);
+          break;
+        }
+      handles.erase(victim);
+    }
+
+    now += random() % (uint64_t{ 1 } << (random() % 30));
+    LinkedList<int> expired = wheel.advance(now);
+    uint64_t previous_deadline = 0;
+    for (auto it = expired.begin(); it != expired.end(); ++it) {
+      int id = *it;
+      ASSERT_LE(deadline_of[id], now);
+      ASSERT_GE(deadline_of[id], previous_deadline);
+      previous_deadline = deadline_of[id];
+      ASSERT_FALSE(wheel.pending(handles[id]));
+      handles.erase(id);
+    }
+    size_t due = 0;
+    while (!expected.empty() && expected.begin()->first <= now) {
+      expected.erase(expected.begin());
+      due += 1;
+    }
+    ASSERT_EQ(expired.size(), due);
+    ASSERT_EQ(wheel.size(), expected.size());
+  }
+}
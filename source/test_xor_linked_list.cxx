@@ -0,0 +1,103 @@
+#include "XorLinkedList.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace DataStructures;
+
+namespace {
+
+template<typename T>
+std::vector<T>
+backward(const XorLinkedList<T>& list)
+{
+  std::vector<T> contents{};
+  for (auto it = list.rbegin(); it != list.rend(); ++it)
+    contents.push_back(*it);
+  return contents;
+}
+
+} // namespace
+
+TEST(XorLinkedListTest, EmptyListIsEmpty)
+{
+  XorLinkedList<int> empty{};
+  ASSERT_TRUE(empty.empty());
+  ASSERT_EQ(empty.size(), 0);
+  ASSERT_EQ(empty.begin(), empty.end());
+  ASSERT_EQ(empty.rbegin(), empty.rend());
+}
+
+TEST(XorLinkedListTest, ListIsTheSameForwardAndBackward)
+{
+  XorLinkedList<std::string> wizards{ "Gandalf", "Saruman", "Radagast" };
+  std::vector<std::string> forward{};
+  for (auto it = wizards.begin(); it != wizards.end(); ++it)
+    forward.push_back(*it);
+  ASSERT_EQ(forward,
+            (std::vector<std::string>{ "Gandalf", "Saruman", "Radagast" }));
+  ASSERT_EQ(backward(wizards),
+            (std::vector<std::string>{ "Radagast", "Saruman", "Gandalf" }));
+}
+
+TEST(XorLinkedListTest, PushesAndPopsWorkAtEitherEnd)
+{
+  XorLinkedList<int> list{};
+  list.push_back(2);
+  list.push_front(1);
+  list.push_back(3);
+  list.push_front(0);
+  ASSERT_EQ(list.size(), 4);
+  ASSERT_EQ(list.front(), 0);
+  ASSERT_EQ(list.back(), 3);
+  ASSERT_EQ(list.pop_back(), 3);
+  ASSERT_EQ(list.pop_back(), 2);
+  ASSERT_EQ(list.pop_front(), 0);
+  ASSERT_EQ(list.cfront(), 1);
+  ASSERT_EQ(list.cback(), 1);
+  ASSERT_EQ(list.pop_back(), 1);
+  ASSERT_TRUE(list.empty());
+  list.push_front(5);
+  ASSERT_EQ(backward(list), (std::vector<int>{ 5 }));
+}
+
+TEST(XorLinkedListTest, RemoveRelinksBothNeighbours)
+{
+  XorLinkedList<char> letters{ 'a', 'b', 'c', 'b', 'd' };
+  ASSERT_TRUE(letters.remove('b'));
+  ASSERT_EQ(letters, (XorLinkedList<char>{ 'a', 'c', 'b', 'd' }));
+  ASSERT_EQ(backward(letters), (std::vector<char>{ 'd', 'b', 'c', 'a' }));
+  ASSERT_TRUE(letters.remove('a'));
+  ASSERT_TRUE(letters.remove('d'));
+  ASSERT_FALSE(letters.remove('z'));
+  ASSERT_EQ(backward(letters), (std::vector<char>{ 'b', 'c' }));
+  ASSERT_EQ(letters.front(), 'c');
+  ASSERT_EQ(letters.back(), 'b');
+}
+
+TEST(XorLinkedListTest, MapChangesEveryElement)
+{
+  XorLinkedList<int> list{ 1, 2, 3 };
+  list.map([](const int& x) { return -x; });
+  ASSERT_EQ(list, (XorLinkedList<int>{ -1, -2, -3 }));
+  ASSERT_NE(list, (XorLinkedList<int>{ -1, -2 }));
+}
+
+TEST(XorLinkedListTest, CopiesAreIndependentAndMovesSwap)
+{
+  XorLinkedList<int> original{ 1, 2, 3 };
+  XorLinkedList<int> copy{ original };
+  copy.pop_back();
+  ASSERT_EQ(original.size(), 3);
+  ASSERT_EQ(backward(copy), (std::vector<int>{ 2, 1 }));
+
+  XorLinkedList<int> moved{ std::move(copy) };
+  ASSERT_TRUE(copy.empty());
+  moved = std::move(original);
+  ASSERT_EQ(moved, (XorLinkedList<int>{ 1, 2, 3 }));
+  ASSERT_EQ(original, (XorLinkedList<int>{ 1, 2 }));
+  original = moved;
+  ASSERT_EQ(backward(original), (std::vector<int>{ 3, 2, 1 }));
+}